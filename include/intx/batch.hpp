@@ -0,0 +1,550 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The structure-of-arrays batch of big integers.
+///
+/// The uint_batch<N, Lanes> stores the word i of all lanes contiguously, so the element-wise
+/// operations process whole vectors of lanes word by word. The carries are propagated per lane
+/// with masks instead of the serial carry chain of the uint<N> operations.
+/// The AVX-512 or AVX2 kernels are selected at compile time (e.g. by -mavx512f or -mavx2).
+
+#pragma once
+
+#include <intx/intx.hpp>
+
+#if INTX_HAS_X86_64_ASM && (defined(__AVX512F__) || defined(__AVX2__))
+    #include <immintrin.h>
+#endif
+
+namespace intx
+{
+template <unsigned N, size_t Lanes = 8>
+struct uint_batch
+{
+    static_assert(Lanes > 0 && Lanes <= 64, "the lane masks are 64-bit");
+
+    static constexpr auto num_words = uint<N>::num_words;
+    static constexpr auto num_lanes = Lanes;
+
+    /// The words: words[i][l] is the word i of the lane l.
+    alignas(64) uint64_t words[num_words][Lanes];
+
+    /// Loads the values to the lanes (transposition from the array of uint<N>).
+    static constexpr uint_batch gather(const uint<N>* values) noexcept
+    {
+        uint_batch b;
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            for (size_t i = 0; i < num_words; ++i)
+                b.words[i][l] = values[l][i];
+        }
+        return b;
+    }
+
+    /// Loads the values selected by the indexes to the lanes.
+    static constexpr uint_batch gather(const uint<N>* values, const size_t* indexes) noexcept
+    {
+        uint_batch b;
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            for (size_t i = 0; i < num_words; ++i)
+                b.words[i][l] = values[indexes[l]][i];
+        }
+        return b;
+    }
+
+    /// Stores the lanes to the values (transposition to the array of uint<N>).
+    constexpr void scatter(uint<N>* values) const noexcept
+    {
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            for (size_t i = 0; i < num_words; ++i)
+                values[l][i] = words[i][l];
+        }
+    }
+
+    /// Stores the lanes to the values selected by the indexes.
+    constexpr void scatter(uint<N>* values, const size_t* indexes) const noexcept
+    {
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+            for (size_t i = 0; i < num_words; ++i)
+                values[indexes[l]][i] = words[i][l];
+        }
+    }
+
+    /// Returns the value of the lane.
+    constexpr uint<N> get(size_t lane) const noexcept
+    {
+        uint<N> x;
+        for (size_t i = 0; i < num_words; ++i)
+            x[i] = words[i][lane];
+        return x;
+    }
+
+    /// Sets the value of the lane.
+    constexpr void set(size_t lane, const uint<N>& x) noexcept
+    {
+        for (size_t i = 0; i < num_words; ++i)
+            words[i][lane] = x[i];
+    }
+
+    /// Sets all lanes to the value.
+    static constexpr uint_batch broadcast(const uint<N>& x) noexcept
+    {
+        uint_batch b;
+        for (size_t i = 0; i < num_words; ++i)
+        {
+            for (size_t l = 0; l < Lanes; ++l)
+                b.words[i][l] = x[i];
+        }
+        return b;
+    }
+};
+
+namespace internal
+{
+/// The lane operations of uint_batch.
+///
+/// The functions process the words of the lanes [first, Lanes). The SIMD kernels process
+/// the vectors of lanes from the lane 0 and return the first unprocessed lane,
+/// the portable functions process the remaining lanes.
+namespace batch
+{
+/// The mask of the lanes l where the bit l is set.
+using lane_mask = uint64_t;
+
+template <unsigned N, size_t Lanes>
+constexpr void add(uint_batch<N, Lanes>& r, const uint_batch<N, Lanes>& x,
+    const uint_batch<N, Lanes>& y, size_t first) noexcept
+{
+    for (size_t l = first; l < Lanes; ++l)
+    {
+        bool carry = false;
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+            std::tie(r.words[i][l], carry) = addc(x.words[i][l], y.words[i][l], carry);
+    }
+}
+
+template <unsigned N, size_t Lanes>
+constexpr void sub(uint_batch<N, Lanes>& r, const uint_batch<N, Lanes>& x,
+    const uint_batch<N, Lanes>& y, size_t first) noexcept
+{
+    for (size_t l = first; l < Lanes; ++l)
+    {
+        bool borrow = false;
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+            std::tie(r.words[i][l], borrow) = subc(x.words[i][l], y.words[i][l], borrow);
+    }
+}
+
+template <unsigned N, size_t Lanes>
+constexpr lane_mask eq(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y, size_t first) noexcept
+{
+    lane_mask m = 0;
+    for (size_t l = first; l < Lanes; ++l)
+    {
+        uint64_t d = 0;
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+            d |= x.words[i][l] ^ y.words[i][l];
+        m |= lane_mask{d == 0} << l;
+    }
+    return m;
+}
+
+template <unsigned N, size_t Lanes>
+constexpr lane_mask lt(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y, size_t first) noexcept
+{
+    lane_mask m = 0;
+    for (size_t l = first; l < Lanes; ++l)
+    {
+        bool borrow = false;
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+            borrow = subc(x.words[i][l], y.words[i][l], borrow).carry;
+        m |= lane_mask{borrow} << l;
+    }
+    return m;
+}
+
+#if INTX_HAS_X86_64_ASM && defined(__AVX512F__)
+/// Adds 8 lanes at a time. The carry is propagated in the mask register: the carry-out
+/// of a word is s < x or (carry-in and s + 1 wrapped to 0).
+template <unsigned N, size_t Lanes>
+inline size_t add_simd(uint_batch<N, Lanes>& r, const uint_batch<N, Lanes>& x,
+    const uint_batch<N, Lanes>& y) noexcept
+{
+    const auto one = _mm512_set1_epi64(1);
+    size_t l = 0;
+    for (; l + 8 <= Lanes; l += 8)
+    {
+        __mmask8 carry = 0;
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+        {
+            const auto a = _mm512_loadu_si512(&x.words[i][l]);
+            const auto s = _mm512_add_epi64(a, _mm512_loadu_si512(&y.words[i][l]));
+            const auto t = _mm512_mask_add_epi64(s, carry, s, one);
+            carry = _mm512_cmplt_epu64_mask(s, a) |
+                    _mm512_mask_cmpeq_epu64_mask(carry, t, _mm512_setzero_si512());
+            _mm512_storeu_si512(&r.words[i][l], t);
+        }
+    }
+    return l;
+}
+
+/// Subtracts 8 lanes at a time. The borrow-out of a word is x < y or (borrow-in and x - y
+/// equal to 0 before the borrow is subtracted).
+template <unsigned N, size_t Lanes>
+inline size_t sub_simd(uint_batch<N, Lanes>& r, const uint_batch<N, Lanes>& x,
+    const uint_batch<N, Lanes>& y) noexcept
+{
+    const auto one = _mm512_set1_epi64(1);
+    size_t l = 0;
+    for (; l + 8 <= Lanes; l += 8)
+    {
+        __mmask8 borrow = 0;
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+        {
+            const auto a = _mm512_loadu_si512(&x.words[i][l]);
+            const auto b = _mm512_loadu_si512(&y.words[i][l]);
+            const auto d = _mm512_sub_epi64(a, b);
+            const auto t = _mm512_mask_sub_epi64(d, borrow, d, one);
+            borrow = _mm512_cmplt_epu64_mask(a, b) |
+                     _mm512_mask_cmpeq_epu64_mask(borrow, d, _mm512_setzero_si512());
+            _mm512_storeu_si512(&r.words[i][l], t);
+        }
+    }
+    return l;
+}
+
+template <unsigned N, size_t Lanes>
+inline size_t eq_simd(
+    lane_mask& m, const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    size_t l = 0;
+    for (; l + 8 <= Lanes; l += 8)
+    {
+        __mmask8 e = 0xff;
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+        {
+            e = _mm512_mask_cmpeq_epu64_mask(
+                e, _mm512_loadu_si512(&x.words[i][l]), _mm512_loadu_si512(&y.words[i][l]));
+        }
+        m |= lane_mask{e} << l;
+    }
+    return l;
+}
+
+/// The x < y is the borrow-out of x - y. The borrow is computed from the most significant
+/// word: the lanes already less or greater are decided, the equal lanes go on.
+template <unsigned N, size_t Lanes>
+inline size_t lt_simd(
+    lane_mask& m, const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    size_t l = 0;
+    for (; l + 8 <= Lanes; l += 8)
+    {
+        __mmask8 less = 0;
+        __mmask8 undecided = 0xff;
+        for (size_t i = uint_batch<N, Lanes>::num_words; i-- != 0;)
+        {
+            const auto a = _mm512_loadu_si512(&x.words[i][l]);
+            const auto b = _mm512_loadu_si512(&y.words[i][l]);
+            less |= _mm512_mask_cmplt_epu64_mask(undecided, a, b);
+            undecided = _mm512_mask_cmpeq_epu64_mask(undecided, a, b);
+        }
+        m |= lane_mask{less} << l;
+    }
+    return l;
+}
+#elif INTX_HAS_X86_64_ASM && defined(__AVX2__)
+/// The unsigned x < y: AVX2 has only the signed comparison, so the sign bits are flipped.
+inline __m256i cmplt_epu64(__m256i x, __m256i y) noexcept
+{
+    const auto sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(y, sign), _mm256_xor_si256(x, sign));
+}
+
+/// Adds 4 lanes at a time. The carry is the vector of the lane masks (0 or -1), so adding
+/// the carry is subtracting the mask.
+template <unsigned N, size_t Lanes>
+inline size_t add_simd(uint_batch<N, Lanes>& r, const uint_batch<N, Lanes>& x,
+    const uint_batch<N, Lanes>& y) noexcept
+{
+    size_t l = 0;
+    for (; l + 4 <= Lanes; l += 4)
+    {
+        auto carry = _mm256_setzero_si256();
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+        {
+            const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x.words[i][l]));
+            const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&y.words[i][l]));
+            const auto s = _mm256_add_epi64(a, b);
+            const auto t = _mm256_sub_epi64(s, carry);
+            carry = _mm256_or_si256(cmplt_epu64(s, a),
+                _mm256_and_si256(carry, _mm256_cmpeq_epi64(t, _mm256_setzero_si256())));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&r.words[i][l]), t);
+        }
+    }
+    return l;
+}
+
+template <unsigned N, size_t Lanes>
+inline size_t sub_simd(uint_batch<N, Lanes>& r, const uint_batch<N, Lanes>& x,
+    const uint_batch<N, Lanes>& y) noexcept
+{
+    size_t l = 0;
+    for (; l + 4 <= Lanes; l += 4)
+    {
+        auto borrow = _mm256_setzero_si256();
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+        {
+            const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x.words[i][l]));
+            const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&y.words[i][l]));
+            const auto d = _mm256_sub_epi64(a, b);
+            const auto t = _mm256_add_epi64(d, borrow);
+            borrow = _mm256_or_si256(cmplt_epu64(a, b),
+                _mm256_and_si256(borrow, _mm256_cmpeq_epi64(d, _mm256_setzero_si256())));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&r.words[i][l]), t);
+        }
+    }
+    return l;
+}
+
+template <unsigned N, size_t Lanes>
+inline size_t eq_simd(
+    lane_mask& m, const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    size_t l = 0;
+    for (; l + 4 <= Lanes; l += 4)
+    {
+        auto e = _mm256_set1_epi64x(-1);
+        for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+        {
+            const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x.words[i][l]));
+            const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&y.words[i][l]));
+            e = _mm256_and_si256(e, _mm256_cmpeq_epi64(a, b));
+        }
+        m |= lane_mask{static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(e)))} << l;
+    }
+    return l;
+}
+
+template <unsigned N, size_t Lanes>
+inline size_t lt_simd(
+    lane_mask& m, const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    size_t l = 0;
+    for (; l + 4 <= Lanes; l += 4)
+    {
+        auto less = _mm256_setzero_si256();
+        auto undecided = _mm256_set1_epi64x(-1);
+        for (size_t i = uint_batch<N, Lanes>::num_words; i-- != 0;)
+        {
+            const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x.words[i][l]));
+            const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&y.words[i][l]));
+            less = _mm256_or_si256(less, _mm256_and_si256(undecided, cmplt_epu64(a, b)));
+            undecided = _mm256_and_si256(undecided, _mm256_cmpeq_epi64(a, b));
+        }
+        m |= lane_mask{static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(less)))}
+             << l;
+    }
+    return l;
+}
+#else
+template <unsigned N, size_t Lanes>
+inline size_t add_simd(
+    uint_batch<N, Lanes>&, const uint_batch<N, Lanes>&, const uint_batch<N, Lanes>&) noexcept
+{
+    return 0;
+}
+
+template <unsigned N, size_t Lanes>
+inline size_t sub_simd(
+    uint_batch<N, Lanes>&, const uint_batch<N, Lanes>&, const uint_batch<N, Lanes>&) noexcept
+{
+    return 0;
+}
+
+template <unsigned N, size_t Lanes>
+inline size_t eq_simd(
+    lane_mask&, const uint_batch<N, Lanes>&, const uint_batch<N, Lanes>&) noexcept
+{
+    return 0;
+}
+
+template <unsigned N, size_t Lanes>
+inline size_t lt_simd(
+    lane_mask&, const uint_batch<N, Lanes>&, const uint_batch<N, Lanes>&) noexcept
+{
+    return 0;
+}
+#endif
+}  // namespace batch
+}  // namespace internal
+
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator+(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    uint_batch<N, Lanes> r;
+    size_t first = 0;
+    if (!std::is_constant_evaluated())
+        first = internal::batch::add_simd(r, x, y);
+    internal::batch::add(r, x, y, first);
+    return r;
+}
+
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator-(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    uint_batch<N, Lanes> r;
+    size_t first = 0;
+    if (!std::is_constant_evaluated())
+        first = internal::batch::sub_simd(r, x, y);
+    internal::batch::sub(r, x, y, first);
+    return r;
+}
+
+/// Returns the mask of the lanes where x == y.
+template <unsigned N, size_t Lanes>
+constexpr uint64_t cmp_eq(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    uint64_t m = 0;
+    size_t first = 0;
+    if (!std::is_constant_evaluated())
+        first = internal::batch::eq_simd(m, x, y);
+    return m | internal::batch::eq(x, y, first);
+}
+
+/// Returns the mask of the lanes where x < y.
+template <unsigned N, size_t Lanes>
+constexpr uint64_t cmp_lt(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    uint64_t m = 0;
+    size_t first = 0;
+    if (!std::is_constant_evaluated())
+        first = internal::batch::lt_simd(m, x, y);
+    return m | internal::batch::lt(x, y, first);
+}
+
+/// Returns the mask of the lanes where x <= y.
+template <unsigned N, size_t Lanes>
+constexpr uint64_t cmp_le(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    return ~cmp_lt(y, x) & (~uint64_t{0} >> (64 - Lanes));
+}
+
+// The bitwise operators and the shifts do not propagate anything between the lanes.
+// The word-by-word loops over the lanes are vectorized by the compiler.
+
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator&(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    uint_batch<N, Lanes> r;
+    for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+    {
+        for (size_t l = 0; l < Lanes; ++l)
+            r.words[i][l] = x.words[i][l] & y.words[i][l];
+    }
+    return r;
+}
+
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator|(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    uint_batch<N, Lanes> r;
+    for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+    {
+        for (size_t l = 0; l < Lanes; ++l)
+            r.words[i][l] = x.words[i][l] | y.words[i][l];
+    }
+    return r;
+}
+
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator^(
+    const uint_batch<N, Lanes>& x, const uint_batch<N, Lanes>& y) noexcept
+{
+    uint_batch<N, Lanes> r;
+    for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+    {
+        for (size_t l = 0; l < Lanes; ++l)
+            r.words[i][l] = x.words[i][l] ^ y.words[i][l];
+    }
+    return r;
+}
+
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator~(const uint_batch<N, Lanes>& x) noexcept
+{
+    uint_batch<N, Lanes> r;
+    for (size_t i = 0; i < uint_batch<N, Lanes>::num_words; ++i)
+    {
+        for (size_t l = 0; l < Lanes; ++l)
+            r.words[i][l] = ~x.words[i][l];
+    }
+    return r;
+}
+
+/// Shifts all lanes left by the same number of bits.
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator<<(const uint_batch<N, Lanes>& x, uint64_t shift) noexcept
+{
+    constexpr auto num_words = uint_batch<N, Lanes>::num_words;
+    uint_batch<N, Lanes> r{};
+    if (shift >= N)
+        return r;
+
+    const auto word_shift = static_cast<size_t>(shift / 64);
+    const auto bit_shift = static_cast<unsigned>(shift % 64);
+    for (size_t i = word_shift; i < num_words; ++i)
+    {
+        const auto& lo = x.words[i - word_shift];
+        for (size_t l = 0; l < Lanes; ++l)
+            r.words[i][l] = lo[l] << bit_shift;
+        if (bit_shift != 0 && i > word_shift)
+        {
+            const auto& below = x.words[i - word_shift - 1];
+            for (size_t l = 0; l < Lanes; ++l)
+                r.words[i][l] |= below[l] >> (64 - bit_shift);
+        }
+    }
+    return r;
+}
+
+/// Shifts all lanes right by the same number of bits.
+template <unsigned N, size_t Lanes>
+constexpr uint_batch<N, Lanes> operator>>(const uint_batch<N, Lanes>& x, uint64_t shift) noexcept
+{
+    constexpr auto num_words = uint_batch<N, Lanes>::num_words;
+    uint_batch<N, Lanes> r{};
+    if (shift >= N)
+        return r;
+
+    const auto word_shift = static_cast<size_t>(shift / 64);
+    const auto bit_shift = static_cast<unsigned>(shift % 64);
+    for (size_t i = 0; i < num_words - word_shift; ++i)
+    {
+        const auto& hi = x.words[i + word_shift];
+        for (size_t l = 0; l < Lanes; ++l)
+            r.words[i][l] = hi[l] >> bit_shift;
+        if (bit_shift != 0 && i + word_shift + 1 < num_words)
+        {
+            const auto& above = x.words[i + word_shift + 1];
+            for (size_t l = 0; l < Lanes; ++l)
+                r.words[i][l] |= above[l] << (64 - bit_shift);
+        }
+    }
+    return r;
+}
+}  // namespace intx
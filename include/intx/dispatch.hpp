@@ -0,0 +1,111 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Runtime CPU dispatch for the hot kernels.
+///
+/// The functions in the intx::dispatch namespace select the best implementation for the CPU
+/// once, on the first use, and then call it through a function pointer. This allows building
+/// a single binary for a mixed fleet of CPUs without -march flags. The constexpr and inline
+/// functions from intx.hpp are not affected.
+///
+/// The kernels and the entry points are compiled once in the intx::dispatch library
+/// (lib/intx/dispatch.cpp). Link with it to use this header.
+
+#pragma once
+
+#include <intx/intx.hpp>
+
+namespace intx
+{
+namespace dispatch
+{
+/// The implementation variants.
+///
+/// The variants are cumulative (as the x86-64 microarchitecture levels): a variant requires
+/// the CPU features of all lower variants.
+enum class variant : uint8_t
+{
+    portable,
+    bmi2_adx,     ///< BMI2, ADX and LZCNT (Intel Broadwell, AMD Zen).
+    avx2,         ///< AVX2.
+    avx512,       ///< AVX-512 F and BW.
+    avx512_ifma,  ///< AVX-512 IFMA (52-bit integer multiply-add).
+};
+
+constexpr const char* to_string(variant v) noexcept
+{
+    switch (v)
+    {
+    case variant::portable:
+        return "portable";
+    case variant::bmi2_adx:
+        return "bmi2_adx";
+    case variant::avx2:
+        return "avx2";
+    case variant::avx512:
+        return "avx512";
+    case variant::avx512_ifma:
+        return "avx512_ifma";
+    }
+    return "unknown";
+}
+
+/// The table of the kernel implementations.
+struct kernel_table
+{
+    /// The variant of the arithmetic kernels: umul, udivrem, mulmod, addmod.
+    variant arithmetic = variant::portable;
+
+    /// The variant of the byte processing kernels: bswap, hex_encode.
+    variant bytes = variant::portable;
+
+    /// The variant of the batched kernels: mulmod_batch.
+    variant batch = variant::portable;
+
+    uint512 (*umul)(const uint256& x, const uint256& y) noexcept = nullptr;
+    div_result<uint256> (*udivrem)(const uint256& x, const uint256& y) noexcept = nullptr;
+    uint256 (*mulmod)(const uint256& x, const uint256& y, const uint256& mod) noexcept = nullptr;
+    uint256 (*addmod)(const uint256& x, const uint256& y, const uint256& mod) noexcept = nullptr;
+    void (*bswap)(uint256* data, size_t size) noexcept = nullptr;
+    char* (*hex_encode)(char* out, const uint8_t* data, size_t size) noexcept = nullptr;
+    void (*mulmod_batch)(const uint256* x, const uint256* y, size_t size, const uint256& mod,
+        uint256* out) noexcept = nullptr;
+};
+
+/// Checks if the CPU supports the variant (including all lower variants).
+bool supported(variant v) noexcept;
+
+/// Returns the best variant supported by the CPU.
+variant detect() noexcept;
+
+/// Creates the table with the best implementations up to the given variant.
+/// The CPU support of the variant is not checked.
+kernel_table make_kernel_table(variant v) noexcept;
+
+/// Returns the kernel table selected for the CPU. The selection is done on the first call.
+const kernel_table& kernels() noexcept;
+
+uint512 umul(const uint256& x, const uint256& y) noexcept;
+
+div_result<uint256> udivrem(const uint256& x, const uint256& y) noexcept;
+
+uint256 mulmod(const uint256& x, const uint256& y, const uint256& mod) noexcept;
+
+uint256 addmod(const uint256& x, const uint256& y, const uint256& mod) noexcept;
+
+/// Reverses the byte order of all values in place.
+void bswap(std::span<uint256> values) noexcept;
+
+/// Encodes the bytes as lowercase hex digits (without the 0x prefix).
+/// The output must have space for 2 * bytes.size() characters.
+/// Returns the pointer past the last written character.
+char* hex_encode(char* out, std::span<const uint8_t> bytes) noexcept;
+
+/// Computes out[i] = x[i]·y[i] mod m for all values.
+/// All spans must have the same size. The output may alias the inputs.
+void mulmod_batch(std::span<const uint256> x, std::span<const uint256> y, const uint256& mod,
+    std::span<uint256> out) noexcept;
+}  // namespace dispatch
+}  // namespace intx
@@ -8,6 +8,7 @@
 #include <array>
 #include <bit>
 #include <cassert>
+#include <charconv>
 #include <climits>
 #include <compare>
 #include <concepts>
@@ -16,12 +17,22 @@
 #include <cstdio>   // fputs
 #include <cstdlib>  // abort
 #include <cstring>
+#include <functional>
+#include <iosfwd>
 #include <limits>
+#include <optional>
 #include <span>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <variant>
+#include <vector>
+#include <version>
+
+#ifdef __cpp_lib_format
+    #include <format>
+#endif
 
 #ifdef _MSC_VER
     #pragma warning(push)
@@ -40,6 +51,20 @@
     #include <intrin.h>
 #endif
 
+// Detect the x86-64 SSE2 (the baseline of the architecture).
+#if defined(__x86_64__) || defined(_M_X64)
+    #define INTX_HAS_SSE2 1
+    #include <emmintrin.h>
+    #ifdef __SSSE3__
+        #include <tmmintrin.h>
+    #endif
+    #if defined(__AVX2__) || defined(__BMI2__)
+        #include <immintrin.h>
+    #endif
+#else
+    #define INTX_HAS_SSE2 0
+#endif
+
 #if __has_builtin(__builtin_expect)
     #define INTX_UNLIKELY(EXPR) __builtin_expect(bool{EXPR}, false)
 #else
@@ -60,6 +85,23 @@
     #define INTX_HAS_BUILTIN_INT128 0
 #endif
 
+// Detect support for the x86-64 inline assembly (GCC extended asm syntax).
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define INTX_HAS_X86_64_ASM 1
+#else
+    #define INTX_HAS_X86_64_ASM 0
+#endif
+
+// Use the MULX/ADX multiplication kernels if the target supports BMI2 and ADX
+// (e.g. -mbmi2 -madx or -march=broadwell). Can be disabled by defining it to 0.
+#ifndef INTX_USE_MULX_ADX
+    #if INTX_HAS_X86_64_ASM && defined(__BMI2__) && defined(__ADX__)
+        #define INTX_USE_MULX_ADX 1
+    #else
+        #define INTX_USE_MULX_ADX 0
+    #endif
+#endif
+
 namespace intx
 {
 /// Mark a possible code path as unreachable (invokes undefined behavior).
@@ -815,72 +857,268 @@ constexpr uint8_t from_hex_digit(char c)
     return from_dec_digit(c);
 }
 
-template <typename Int>
-constexpr Int from_string(const char* str)
+#if INTX_HAS_X86_64_ASM
+/// The x86-64 multiplication kernels using the MULX (BMI2) and ADCX/ADOX (ADX) instructions.
+///
+/// The ADCX and ADOX use independent carry flags (CF and OF), so the additions of the low and
+/// high halves of the word products form two parallel carry chains. The kernels are always
+/// compiled (the assembler accepts the instructions without the target flags), but the library
+/// uses them only if INTX_USE_MULX_ADX is enabled. The caller must make sure the CPU supports
+/// both the BMI2 and the ADX.
+namespace internal::x86_64
 {
-    auto s = str;
-    auto x = Int{};
-    size_t num_digits = 0;
-
-    if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
-    {
-        s += 2;
-        while (const auto c = *s++)
-        {
-            if (++num_digits > sizeof(x) * 2)
-                throw_<std::out_of_range>(str);
-            x = (x << uint64_t{4}) | from_hex_digit(c);
-        }
-        return x;
-    }
-
-    while (const auto c = *s++)
-    {
-        if (num_digits++ > std::numeric_limits<Int>::digits10)
-            throw_<std::out_of_range>(str);
+    #define INTX_MULX_ADCX_ADOX(X_OFFSET, LO_ACC, HI_ACC)   \
+        "mulxq " #X_OFFSET "(%[x]), %[lo], %[hi]\n\t" \
+        "adcxq %[lo], %[" #LO_ACC "]\n\t"             \
+        "adoxq %[hi], %[" #HI_ACC "]\n\t"
 
-        const auto d = from_dec_digit(c);
-        x = x * Int{10} + d;
-        if (x < d)
-            throw_<std::out_of_range>(str);
-    }
-    return x;
+/// Full multiplication p[0:8] = x[0:4] * y[0:4].
+inline void umul_256(uint64_t p[8], const uint64_t x[4], const uint64_t y[4]) noexcept
+{
+    uint64_t lo, hi, r0, r1, r2, r3, r4, r5, r6, r7;  // NOLINT(cppcoreguidelines-init-variables)
+    asm(
+        "movq (%[y]), %%rdx\n\t"
+        "mulxq (%[x]), %[r0], %[r1]\n\t"
+        "mulxq 8(%[x]), %[lo], %[r2]\n\t"
+        "addq %[lo], %[r1]\n\t"
+        "mulxq 16(%[x]), %[lo], %[r3]\n\t"
+        "adcq %[lo], %[r2]\n\t"
+        "mulxq 24(%[x]), %[lo], %[r4]\n\t"
+        "adcq %[lo], %[r3]\n\t"
+        "adcq $0, %[r4]\n\t"
+
+        "movq 8(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r1, r2)
+        INTX_MULX_ADCX_ADOX(8, r2, r3)
+        INTX_MULX_ADCX_ADOX(16, r3, r4)
+        "mulxq 24(%[x]), %[lo], %[r5]\n\t"
+        "adcxq %[lo], %[r4]\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adoxq %[lo], %[r5]\n\t"
+        "adcxq %[lo], %[r5]\n\t"
+
+        "movq 16(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r2, r3)
+        INTX_MULX_ADCX_ADOX(8, r3, r4)
+        INTX_MULX_ADCX_ADOX(16, r4, r5)
+        "mulxq 24(%[x]), %[lo], %[r6]\n\t"
+        "adcxq %[lo], %[r5]\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adoxq %[lo], %[r6]\n\t"
+        "adcxq %[lo], %[r6]\n\t"
+
+        "movq 24(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r3, r4)
+        INTX_MULX_ADCX_ADOX(8, r4, r5)
+        INTX_MULX_ADCX_ADOX(16, r5, r6)
+        "mulxq 24(%[x]), %[lo], %[r7]\n\t"
+        "adcxq %[lo], %[r6]\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adoxq %[lo], %[r7]\n\t"
+        "adcxq %[lo], %[r7]"
+        : [lo] "=&r"(lo), [hi] "=&r"(hi), [r0] "=&r"(r0), [r1] "=&r"(r1), [r2] "=&r"(r2),
+        [r3] "=&r"(r3), [r4] "=&r"(r4), [r5] "=&r"(r5), [r6] "=&r"(r6), [r7] "=&r"(r7)
+        : [x] "r"(x), [y] "r"(y)
+        : "rdx", "cc", "memory");
+    p[0] = r0;
+    p[1] = r1;
+    p[2] = r2;
+    p[3] = r3;
+    p[4] = r4;
+    p[5] = r5;
+    p[6] = r6;
+    p[7] = r7;
 }
 
-template <typename Int>
-constexpr Int from_string(const std::string& s)
+/// Truncated multiplication p[0:4] = x[0:4] * y[0:4] mod 2^256.
+inline void mul_256(uint64_t p[4], const uint64_t x[4], const uint64_t y[4]) noexcept
 {
-    return from_string<Int>(s.c_str());
+    uint64_t lo, hi, r0, r1, r2, r3;  // NOLINT(cppcoreguidelines-init-variables)
+    asm(
+        "movq (%[y]), %%rdx\n\t"
+        "mulxq (%[x]), %[r0], %[r1]\n\t"
+        "mulxq 8(%[x]), %[lo], %[r2]\n\t"
+        "addq %[lo], %[r1]\n\t"
+        "mulxq 16(%[x]), %[lo], %[r3]\n\t"
+        "adcq %[lo], %[r2]\n\t"
+        "mulxq 24(%[x]), %[lo], %[hi]\n\t"
+        "adcq %[lo], %[r3]\n\t"
+
+        "movq 8(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r1, r2)
+        INTX_MULX_ADCX_ADOX(8, r2, r3)
+        "mulxq 16(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r3]\n\t"
+
+        "movq 16(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r2, r3)
+        "mulxq 8(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r3]\n\t"
+
+        "movq 24(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        "mulxq 0(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r3]"
+        : [lo] "=&r"(lo), [hi] "=&r"(hi), [r0] "=&r"(r0), [r1] "=&r"(r1), [r2] "=&r"(r2),
+        [r3] "=&r"(r3)
+        : [x] "r"(x), [y] "r"(y)
+        : "rdx", "cc", "memory");
+    p[0] = r0;
+    p[1] = r1;
+    p[2] = r2;
+    p[3] = r3;
 }
 
-template <unsigned N>
-inline std::string to_string(uint<N> x, int base = 10)
+/// Truncated multiplication p[0:8] = x[0:8] * y[0:8] mod 2^512.
+inline void mul_512(uint64_t p[8], const uint64_t x[8], const uint64_t y[8]) noexcept
 {
-    if (base < 2 || base > 36)
-        throw_<std::invalid_argument>("invalid base");
+    uint64_t lo, hi, r0, r1, r2, r3, r4, r5, r6, r7;  // NOLINT(cppcoreguidelines-init-variables)
+    asm(
+        "movq (%[y]), %%rdx\n\t"
+        "mulxq (%[x]), %[r0], %[r1]\n\t"
+        "mulxq 8(%[x]), %[lo], %[r2]\n\t"
+        "addq %[lo], %[r1]\n\t"
+        "mulxq 16(%[x]), %[lo], %[r3]\n\t"
+        "adcq %[lo], %[r2]\n\t"
+        "mulxq 24(%[x]), %[lo], %[r4]\n\t"
+        "adcq %[lo], %[r3]\n\t"
+        "mulxq 32(%[x]), %[lo], %[r5]\n\t"
+        "adcq %[lo], %[r4]\n\t"
+        "mulxq 40(%[x]), %[lo], %[r6]\n\t"
+        "adcq %[lo], %[r5]\n\t"
+        "mulxq 48(%[x]), %[lo], %[r7]\n\t"
+        "adcq %[lo], %[r6]\n\t"
+        "mulxq 56(%[x]), %[lo], %[hi]\n\t"
+        "adcq %[lo], %[r7]\n\t"
+
+        "movq 8(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r1, r2)
+        INTX_MULX_ADCX_ADOX(8, r2, r3)
+        INTX_MULX_ADCX_ADOX(16, r3, r4)
+        INTX_MULX_ADCX_ADOX(24, r4, r5)
+        INTX_MULX_ADCX_ADOX(32, r5, r6)
+        INTX_MULX_ADCX_ADOX(40, r6, r7)
+        "mulxq 48(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r7]\n\t"
+
+        "movq 16(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r2, r3)
+        INTX_MULX_ADCX_ADOX(8, r3, r4)
+        INTX_MULX_ADCX_ADOX(16, r4, r5)
+        INTX_MULX_ADCX_ADOX(24, r5, r6)
+        INTX_MULX_ADCX_ADOX(32, r6, r7)
+        "mulxq 40(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r7]\n\t"
+
+        "movq 24(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r3, r4)
+        INTX_MULX_ADCX_ADOX(8, r4, r5)
+        INTX_MULX_ADCX_ADOX(16, r5, r6)
+        INTX_MULX_ADCX_ADOX(24, r6, r7)
+        "mulxq 32(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r7]\n\t"
+
+        "movq 32(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r4, r5)
+        INTX_MULX_ADCX_ADOX(8, r5, r6)
+        INTX_MULX_ADCX_ADOX(16, r6, r7)
+        "mulxq 24(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r7]\n\t"
+
+        "movq 40(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r5, r6)
+        INTX_MULX_ADCX_ADOX(8, r6, r7)
+        "mulxq 16(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r7]\n\t"
+
+        "movq 48(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        INTX_MULX_ADCX_ADOX(0, r6, r7)
+        "mulxq 8(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r7]\n\t"
+
+        "movq 56(%[y]), %%rdx\n\t"
+        "xorl %k[lo], %k[lo]\n\t"
+        "mulxq 0(%[x]), %[lo], %[hi]\n\t"
+        "adcxq %[lo], %[r7]"
+        : [lo] "=&r"(lo), [hi] "=&r"(hi), [r0] "=&r"(r0), [r1] "=&r"(r1), [r2] "=&r"(r2),
+        [r3] "=&r"(r3), [r4] "=&r"(r4), [r5] "=&r"(r5), [r6] "=&r"(r6), [r7] "=&r"(r7)
+        : [x] "r"(x), [y] "r"(y)
+        : "rdx", "cc", "memory");
+    p[0] = r0;
+    p[1] = r1;
+    p[2] = r2;
+    p[3] = r3;
+    p[4] = r4;
+    p[5] = r5;
+    p[6] = r6;
+    p[7] = r7;
+}
 
-    if (x == 0)
-        return "0";
+    #undef INTX_MULX_ADCX_ADOX
 
-    auto s = std::string{};
-    while (x != 0)
-    {
-        // TODO: Use constexpr udivrem_1?
-        const auto res = udivrem(x, uint<N>{base});
-        const auto d = int(res.rem);
-        const auto c = d < 10 ? '0' + d : 'a' + d - 10;
-        s.push_back(char(c));
-        x = res.quot;
-    }
-    std::ranges::reverse(s);
-    return s;
+/// Subtracts y multiplied by multiplier from x as: x[0:n] -= multiplier * y[0:n].
+/// Returns the borrow word. The n must not be 0.
+///
+/// The high product words are added to the next low words in the ADOX chain (OF).
+/// The SUB/SBB would clobber the OF, so the subtraction is done as the addition of
+/// the complement in the ADCX chain (CF) where the carry means "no borrow".
+inline uint64_t submul(uint64_t x[], const uint64_t y[], size_t n, uint64_t multiplier) noexcept
+{
+    // Iterate with the negative index up to 0 so the loop can be controlled by JRCXZ,
+    // which does not modify the flags.
+    auto i = -static_cast<int64_t>(n);
+    uint64_t lo, hi, t, zero;  // NOLINT(cppcoreguidelines-init-variables)
+    uint64_t k = 0;
+    asm("xorl %k[zero], %k[zero]\n\t"
+        "stc\n\t"
+        "1:\n\t"
+        "mulxq (%[y],%[i],8), %[lo], %[hi]\n\t"
+        "adoxq %[k], %[lo]\n\t"
+        "notq %[lo]\n\t"
+        "movq %[hi], %[k]\n\t"
+        "movq (%[x],%[i],8), %[t]\n\t"
+        "adcxq %[lo], %[t]\n\t"
+        "movq %[t], (%[x],%[i],8)\n\t"
+        "leaq 1(%[i]), %[i]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "adoxq %[zero], %[k]\n\t"
+        "sbbq $-1, %[k]"  // k += 1 - CF
+        : [i] "+c"(i), [k] "+&r"(k), [lo] "=&r"(lo), [hi] "=&r"(hi), [t] "=&r"(t),
+        [zero] "=&r"(zero)
+        : [x] "r"(x + n), [y] "r"(y + n), "d"(multiplier)
+        : "cc", "memory");
+    return k;
 }
+}  // namespace internal::x86_64
+#endif
 
-template <unsigned N>
-inline std::string hex(uint<N> x)
+namespace internal
 {
-    return to_string(x, 16);
-}
+/// The number of words from which the multiplication uses the Karatsuba algorithm.
+inline constexpr size_t karatsuba_threshold = 16;
+
+/// The number of words from which the full multiplication uses the Toom-3 algorithm.
+inline constexpr size_t toom3_threshold = 128;
+
+template <unsigned N>
+constexpr uint<N> mul_portable(const uint<N>& x, const uint<N>& y) noexcept;
+
+template <size_t n>
+constexpr void mul_karatsuba(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept;
+}  // namespace internal
 
 template <unsigned N>
 struct uint
@@ -989,24 +1227,34 @@ public:
 
     constexpr uint& operator-=(const uint& y) noexcept { return *this = *this - y; }
 
-    /// Multiplication implementation using word access
-    /// and discarding the high part of the result product.
+    /// Multiplication discarding the high part of the result product.
     friend constexpr uint operator*(const uint& x, const uint& y) noexcept
     {
-        uint<N> p;
-        for (size_t j = 0; j < num_words; j++)
+#if INTX_USE_MULX_ADX
+        if (!std::is_constant_evaluated())
         {
-            uint64_t k = 0;
-            for (size_t i = 0; i < (num_words - j - 1); i++)
+            if constexpr (N == 256)
+            {
+                uint p;
+                internal::x86_64::mul_256(&p[0], &x[0], &y[0]);
+                return p;
+            }
+            else if constexpr (N == 512)
             {
-                auto a = addc(p[i + j], k);
-                auto t = umul(x[i], y[j]) + uint128{a.value, a.carry};
-                p[i + j] = t[0];
-                k = t[1];
+                uint p;
+                internal::x86_64::mul_512(&p[0], &x[0], &y[0]);
+                return p;
             }
-            p[num_words - 1] += x[num_words - j - 1] * y[j] + k;
         }
-        return p;
+#endif
+        if constexpr (num_words >= internal::karatsuba_threshold)
+        {
+            uint p;
+            internal::mul_karatsuba<num_words>(&p[0], &x[0], &y[0]);
+            return p;
+        }
+        else
+            return internal::mul_portable(x, y);
     }
 
     constexpr uint& operator*=(const uint& y) noexcept { return *this = *this * y; }
@@ -1280,8 +1528,34 @@ inline const uint8_t* as_bytes(const T& x) noexcept
     return reinterpret_cast<const uint8_t*>(&x);
 }
 
+namespace internal
+{
+/// Portable multiplication implementation using word access
+/// and discarding the high part of the result product.
 template <unsigned N>
-constexpr uint<2 * N> umul(const uint<N>& x, const uint<N>& y) noexcept
+constexpr uint<N> mul_portable(const uint<N>& x, const uint<N>& y) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint<N> p;
+    for (size_t j = 0; j < num_words; j++)
+    {
+        uint64_t k = 0;
+        for (size_t i = 0; i < (num_words - j - 1); i++)
+        {
+            auto a = addc(p[i + j], k);
+            auto t = umul(x[i], y[j]) + uint128{a.value, a.carry};
+            p[i + j] = t[0];
+            k = t[1];
+        }
+        p[num_words - 1] += x[num_words - j - 1] * y[j] + k;
+    }
+    return p;
+}
+
+/// Portable full multiplication implementation.
+template <unsigned N>
+constexpr uint<2 * N> umul_portable(const uint<N>& x, const uint<N>& y) noexcept
 {
     constexpr auto num_words = uint<N>::num_words;
 
@@ -1301,6 +1575,425 @@ constexpr uint<2 * N> umul(const uint<N>& x, const uint<N>& y) noexcept
     return p;
 }
 
+/// Adds the n-word numbers z = x + y. Returns the carry.
+template <size_t n>
+constexpr bool add_n(uint64_t* z, const uint64_t* x, const uint64_t* y) noexcept
+{
+    bool carry = false;
+    for (size_t i = 0; i < n; ++i)
+        std::tie(z[i], carry) = addc(x[i], y[i], carry);
+    return carry;
+}
+
+/// Subtracts the n-word numbers z = x - y. Returns the borrow.
+template <size_t n>
+constexpr bool sub_n(uint64_t* z, const uint64_t* x, const uint64_t* y) noexcept
+{
+    bool borrow = false;
+    for (size_t i = 0; i < n; ++i)
+        std::tie(z[i], borrow) = subc(x[i], y[i], borrow);
+    return borrow;
+}
+
+/// Compares the n-word numbers x < y.
+template <size_t n>
+constexpr bool less_n(const uint64_t* x, const uint64_t* y) noexcept
+{
+    for (size_t i = n; i != 0; --i)
+    {
+        if (x[i - 1] != y[i - 1])
+            return x[i - 1] < y[i - 1];
+    }
+    return false;
+}
+
+/// Computes the n-word absolute difference d = |x - y|. Returns true if x < y.
+template <size_t n>
+constexpr bool abs_diff_n(uint64_t* d, const uint64_t* x, const uint64_t* y) noexcept
+{
+    size_t i = n;
+    while (i != 0 && x[i - 1] == y[i - 1])
+        --i;
+    const auto less = i != 0 && x[i - 1] < y[i - 1];
+    if (less)
+        sub_n<n>(d, y, x);
+    else
+        sub_n<n>(d, x, y);
+    return less;
+}
+
+/// Schoolbook full multiplication p[0:2n] = x[0:n] * y[0:n].
+template <size_t n>
+constexpr void umul_basecase(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept
+{
+    uint64_t k = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto t = umul(x[i], y[0]) + k;
+        p[i] = t[0];
+        k = t[1];
+    }
+    p[n] = k;
+
+    for (size_t j = 1; j < n; ++j)
+    {
+        k = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto t = umul(x[i], y[j]) + p[i + j] + k;
+            p[i + j] = t[0];
+            k = t[1];
+        }
+        p[j + n] = k;
+    }
+}
+
+/// Schoolbook multiplication p[0:n] = x[0:n] * y[0:n] discarding the high part of the product.
+template <size_t n>
+constexpr void mul_basecase(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept
+{
+    uint64_t k = 0;
+    for (size_t i = 0; i < n - 1; ++i)
+    {
+        const auto t = umul(x[i], y[0]) + k;
+        p[i] = t[0];
+        k = t[1];
+    }
+    p[n - 1] = x[n - 1] * y[0] + k;
+
+    for (size_t j = 1; j < n; ++j)
+    {
+        k = 0;
+        for (size_t i = 0; i < n - j - 1; ++i)
+        {
+            const auto t = umul(x[i], y[j]) + p[i + j] + k;
+            p[i + j] = t[0];
+            k = t[1];
+        }
+        p[n - 1] += x[n - j - 1] * y[j] + k;
+    }
+}
+
+/// Adds y[0:m] to x[0:n] in place, m <= n, discarding the carry out of x.
+constexpr void add_into(uint64_t* x, size_t n, const uint64_t* y, size_t m) noexcept
+{
+    bool carry = false;
+    size_t i = 0;
+    for (; i < m; ++i)
+        std::tie(x[i], carry) = addc(x[i], y[i], carry);
+    for (; carry && i < n; ++i)
+        std::tie(x[i], carry) = addc(x[i], uint64_t{0}, carry);
+}
+
+/// Negates the n-word two's complement number z = -x.
+template <size_t n>
+constexpr void neg_n(uint64_t* z, const uint64_t* x) noexcept
+{
+    bool borrow = false;
+    for (size_t i = 0; i < n; ++i)
+        std::tie(z[i], borrow) = subc(0, x[i], borrow);
+}
+
+/// Divides the n-word two's complement number x by 2 in place (arithmetic shift right).
+template <size_t n>
+constexpr void half_n(uint64_t* x) noexcept
+{
+    for (size_t i = 0; i < n - 1; ++i)
+        x[i] = (x[i] >> 1) | (x[i + 1] << 63);
+    x[n - 1] = static_cast<uint64_t>(static_cast<int64_t>(x[n - 1]) >> 1);
+}
+
+/// Divides the n-word two's complement number x by 3 in place. The division must be exact.
+///
+/// Each quotient word is the current word times the inverse of 3 mod 2^64, the high word
+/// of the quotient word times 3 is subtracted from the next word.
+template <size_t n>
+constexpr void divexact_by3_n(uint64_t* x) noexcept
+{
+    constexpr uint64_t inv3 = 0xaaaaaaaaaaaaaaab;  // 3·inv3 ≡ 1 mod 2^64.
+    static_assert(3 * inv3 == 1);
+
+    uint64_t k = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto [s, borrow] = subc(x[i], k);
+        x[i] = s * inv3;
+        k = umul(x[i], uint64_t{3})[1] + borrow;
+    }
+}
+
+template <size_t n>
+constexpr void umul_n(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept;
+
+/// Karatsuba full multiplication p[0:2n] = x[0:n] * y[0:n].
+///
+/// For the halves x = x1·B + x0 and y = y1·B + y0 the middle term of the product is
+/// x0·y1 + x1·y0 = x0·y0 + x1·y1 - (x0 - x1)·(y0 - y1), so the product needs
+/// 3 multiplications of the halves instead of 4. For odd n the low halves have one word more.
+/// The scratch space is on the stack, sized by n.
+template <size_t n>
+constexpr void umul_karatsuba(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept
+{
+    constexpr auto l = (n + 1) / 2;
+    constexpr auto h = n - l;
+    umul_n<l>(p, x, y);
+    umul_n<h>(p + 2 * l, x + l, y + l);
+
+    uint64_t x1[l]{};
+    uint64_t y1[l]{};
+    std::copy_n(x + l, h, x1);
+    std::copy_n(y + l, h, y1);
+    uint64_t dx[l];
+    uint64_t dy[l];
+    const auto x_less = abs_diff_n<l>(dx, x, x1);
+    const auto y_less = abs_diff_n<l>(dy, y, y1);
+    uint64_t m[2 * l];
+    umul_n<l>(m, dx, dy);
+
+    // The middle term t (2l words and the carry c) is non-negative and below 2·B^2.
+    uint64_t t[2 * l]{};
+    std::copy_n(p + 2 * l, 2 * h, t);
+    uint64_t c = add_n<2 * l>(t, t, p);
+    if (x_less != y_less)
+        c += add_n<2 * l>(t, t, m);
+    else
+        c -= sub_n<2 * l>(t, t, m);
+
+    c += add_n<2 * l>(p + l, p + l, t);
+    for (size_t i = 3 * l; c != 0 && i < 2 * n; ++i)
+    {
+        const auto t_i = addc(p[i], c);
+        p[i] = t_i.value;
+        c = t_i.carry;
+    }
+}
+
+/// Toom-3 full multiplication p[0:2n] = x[0:n] * y[0:n].
+///
+/// The operands are split into 3 parts of k words, x = x2·B^2 + x1·B + x0, and seen as
+/// polynomials in B. Their product is evaluated at the points 0, 1, -1, -2 and ∞ with
+/// 5 multiplications of (k+1)-word values and interpolated back with Bodrato's sequence.
+/// The negative values are multiplied by their absolute values. The interpolation is done in
+/// two's complement where the exact division by 3 uses the inverse of 3 mod 2^64.
+template <size_t n>
+constexpr void umul_toom3(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept
+{
+    constexpr auto k = (n + 2) / 3;
+    constexpr auto e = k + 1;  // The size of the evaluated values.
+    constexpr auto w = 2 * e;  // The size of the products of the evaluated values.
+    static_assert(2 * k < n);
+
+    // Evaluates the parts of a at 1, -1, -2, in two's complement.
+    const auto eval = [](uint64_t(&v)[3][e], const uint64_t* a) noexcept {
+        uint64_t a0[e]{};
+        uint64_t a1[e]{};
+        uint64_t a2[e]{};
+        std::copy_n(a, k, a0);
+        std::copy_n(a + k, k, a1);
+        std::copy_n(a + 2 * k, n - 2 * k, a2);
+
+        uint64_t s[e];
+        add_n<e>(s, a0, a2);
+        add_n<e>(v[0], s, a1);        // a(1) = a0 + a1 + a2
+        sub_n<e>(v[1], s, a1);        // a(-1) = a0 - a1 + a2
+        add_n<e>(s, v[1], a2);        // a(-2) = 2·(a(-1) + a2) - a0
+        add_n<e>(s, s, s);
+        sub_n<e>(v[2], s, a0);
+    };
+    uint64_t xv[3][e];
+    uint64_t yv[3][e];
+    eval(xv, x);
+    eval(yv, y);
+
+    // Multiplies the values xv[i]·yv[i] by their absolute values.
+    const auto mul_signed = [&xv, &yv](uint64_t* r, size_t i) noexcept {
+        const auto x_neg = static_cast<int64_t>(xv[i][e - 1]) < 0;
+        const auto y_neg = static_cast<int64_t>(yv[i][e - 1]) < 0;
+        if (x_neg)
+            neg_n<e>(xv[i], xv[i]);
+        if (y_neg)
+            neg_n<e>(yv[i], yv[i]);
+        umul_n<e>(r, xv[i], yv[i]);
+        if (x_neg != y_neg)
+            neg_n<w>(r, r);
+    };
+    uint64_t r1[w];
+    uint64_t r2[w];
+    uint64_t r3[w];
+    mul_signed(r1, 0);
+    mul_signed(r2, 1);
+    mul_signed(r3, 2);
+
+    uint64_t r0[w]{};
+    uint64_t r4[w]{};
+    umul_n<k>(r0, x, y);
+    {
+        uint64_t x2[k]{};
+        uint64_t y2[k]{};
+        std::copy_n(x + 2 * k, n - 2 * k, x2);
+        std::copy_n(y + 2 * k, n - 2 * k, y2);
+        umul_n<k>(r4, x2, y2);
+    }
+
+    sub_n<w>(r3, r3, r1);  // r3 = (r(-2) - r(1)) / 3
+    divexact_by3_n<w>(r3);
+    sub_n<w>(r1, r1, r2);  // r1 = (r(1) - r(-1)) / 2
+    half_n<w>(r1);
+    sub_n<w>(r2, r2, r0);  // r2 = r(-1) - r(0)
+    sub_n<w>(r3, r2, r3);  // r3 = (r2 - r3) / 2 + 2·r(∞)
+    half_n<w>(r3);
+    add_n<w>(r3, r3, r4);
+    add_n<w>(r3, r3, r4);
+    add_n<w>(r2, r2, r1);  // r2 = r2 + r1 - r(∞)
+    sub_n<w>(r2, r2, r4);
+    sub_n<w>(r1, r1, r3);  // r1 = r1 - r3
+
+    // The product is r(0) + r1·B + r2·B^2 + r3·B^3 + r(∞)·B^4, where B = 2^(64k).
+    std::fill_n(p, 2 * n, uint64_t{0});
+    std::copy_n(r0, 2 * k, p);
+    std::copy_n(r4, 2 * n - 4 * k, p + 4 * k);
+    add_into(p + k, 2 * n - k, r1, std::min(w, 2 * n - k));
+    add_into(p + 2 * k, 2 * n - 2 * k, r2, std::min(w, 2 * n - 2 * k));
+    add_into(p + 3 * k, 2 * n - 3 * k, r3, std::min(w, 2 * n - 3 * k));
+}
+
+/// Full multiplication p[0:2n] = x[0:n] * y[0:n] with the algorithm selected by n.
+template <size_t n>
+constexpr void umul_n(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept
+{
+    if constexpr (n >= toom3_threshold)
+        umul_toom3<n>(p, x, y);
+    else if constexpr (n >= karatsuba_threshold)
+        umul_karatsuba<n>(p, x, y);
+    else
+        umul_basecase<n>(p, x, y);
+}
+
+/// Karatsuba multiplication p[0:n] = x[0:n] * y[0:n] discarding the high part of the product.
+/// The low part is x0·y0 + (x0·y1 + x1·y0)·B where only the full x0·y0 uses umul_n().
+template <size_t n>
+constexpr void mul_karatsuba(uint64_t* p, const uint64_t* x, const uint64_t* y) noexcept
+{
+    if constexpr (n < karatsuba_threshold)
+    {
+        mul_basecase<n>(p, x, y);
+    }
+    else
+    {
+        constexpr auto l = n / 2;
+        constexpr auto h = n - l;
+        umul_n<l>(p, x, y);
+        if constexpr (h != l)
+            p[n - 1] = 0;
+
+        uint64_t x0[h]{};
+        uint64_t y0[h]{};
+        std::copy_n(x, l, x0);
+        std::copy_n(y, l, y0);
+        uint64_t t[h];
+        mul_karatsuba<h>(t, x0, y + l);
+        add_n<h>(p + l, p + l, t);
+        mul_karatsuba<h>(t, x + l, y0);
+        add_n<h>(p + l, p + l, t);
+    }
+}
+}  // namespace internal
+
+/// Full multiplication.
+template <unsigned N>
+constexpr uint<2 * N> umul(const uint<N>& x, const uint<N>& y) noexcept
+{
+#if INTX_USE_MULX_ADX
+    if constexpr (N == 256)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            uint<2 * N> p;
+            internal::x86_64::umul_256(&p[0], &x[0], &y[0]);
+            return p;
+        }
+    }
+#endif
+    if constexpr (uint<N>::num_words >= internal::karatsuba_threshold)
+    {
+        uint<2 * N> p;
+        internal::umul_n<uint<N>::num_words>(&p[0], &x[0], &y[0]);
+        return p;
+    }
+    else
+        return internal::umul_portable(x, y);
+}
+
+/// Full squaring x·x.
+///
+/// The cross products x[i]·x[j] for i < j are computed once and doubled,
+/// so this needs almost half of the word multiplications of umul(x, x).
+template <unsigned N>
+constexpr uint<2 * N> sqr_full(const uint<N>& x) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint<2 * N> p;
+    for (size_t i = 0; i < num_words - 1; ++i)
+    {
+        uint64_t k = 0;
+        for (size_t j = i + 1; j < num_words; ++j)
+        {
+            const auto t = umul(x[i], x[j]) + p[i + j] + k;
+            p[i + j] = t[0];
+            k = t[1];
+        }
+        p[i + num_words] = k;
+    }
+
+    // Double the cross products and add the squares x[i]·x[i].
+    uint64_t top = 0;  // The top bit shifted out from the previous word.
+    bool carry = false;
+    for (size_t i = 0; i < 2 * num_words; i += 2)
+    {
+        const auto t = umul(x[i / 2], x[i / 2]);
+        const auto lo = (p[i] << 1) | top;
+        const auto hi = (p[i + 1] << 1) | (p[i] >> 63);
+        top = p[i + 1] >> 63;
+        const auto a = addc(lo, t[0], carry);
+        const auto b = addc(hi, t[1], a.carry);
+        p[i] = a.value;
+        p[i + 1] = b.value;
+        carry = b.carry;
+    }
+    return p;
+}
+
+/// Squaring x·x truncated to N bits.
+template <unsigned N>
+constexpr uint<N> sqr(const uint<N>& x) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint<N> p;
+    for (size_t i = 0; i < num_words / 2; ++i)
+    {
+        uint64_t k = 0;
+        for (size_t j = i + 1; j < num_words - i - 1; ++j)
+        {
+            const auto t = umul(x[i], x[j]) + p[i + j] + k;
+            p[i + j] = t[0];
+            k = t[1];
+        }
+        p[num_words - 1] += x[i] * x[num_words - i - 1] + k;
+    }
+
+    uint<N> d;
+    for (size_t i = 0; 2 * i < num_words; ++i)
+    {
+        const auto t = umul(x[i], x[i]);
+        d[2 * i] = t[0];
+        if (2 * i + 1 < num_words)
+            d[2 * i + 1] = t[1];
+    }
+    return (p << 1) + d;
+}
+
 template <unsigned N>
 constexpr uint<N> exp(uint<N> base, uint<N> exponent) noexcept
 {
@@ -1310,7 +2003,7 @@ constexpr uint<N> exp(uint<N> base, uint<N> exponent) noexcept
 
     for (size_t i = bit_width(exponent); i > 0; --i)
     {
-        result *= result;
+        result = sqr(result);
         if (bit_test(exponent, i - 1))
             result *= base;
     }
@@ -1443,15 +2136,14 @@ template <unsigned M, unsigned N>
 }
 
 /// Divides arbitrary long unsigned integer by 64-bit unsigned integer (1 word).
-/// @param u  The normalized numerator words. It will contain the quotient after execution.
-/// @param d  The normalized divisor.
-/// @return   The remainder.
-constexpr uint64_t udivrem_by1(std::span<uint64_t> u, uint64_t d) noexcept
+/// @param u           The normalized numerator words. It will contain the quotient after execution.
+/// @param d           The normalized divisor.
+/// @param reciprocal  The reciprocal of the divisor computed by reciprocal_2by1(d).
+/// @return            The remainder.
+constexpr uint64_t udivrem_by1(std::span<uint64_t> u, uint64_t d, uint64_t reciprocal) noexcept
 {
     INTX_REQUIRE(u.size() >= 2);
 
-    const auto reciprocal = reciprocal_2by1(d);
-
     auto rem = u[u.size() - 1];  // Set the top word as remainder.
     u[u.size() - 1] = 0;         // Reset the word being a part of the result quotient.
 
@@ -1467,15 +2159,23 @@ constexpr uint64_t udivrem_by1(std::span<uint64_t> u, uint64_t d) noexcept
     return rem;
 }
 
-/// Divides arbitrary long unsigned integer by 128-bit unsigned integer (2 words).
+/// Divides arbitrary long unsigned integer by 64-bit unsigned integer (1 word).
 /// @param u  The normalized numerator words. It will contain the quotient after execution.
 /// @param d  The normalized divisor.
 /// @return   The remainder.
-constexpr uint128 udivrem_by2(std::span<uint64_t> u, uint128 d) noexcept
+constexpr uint64_t udivrem_by1(std::span<uint64_t> u, uint64_t d) noexcept
 {
-    INTX_REQUIRE(u.size() >= 3);
+    return udivrem_by1(u, d, reciprocal_2by1(d));
+}
 
-    const auto reciprocal = reciprocal_3by2(d);
+/// Divides arbitrary long unsigned integer by 128-bit unsigned integer (2 words).
+/// @param u           The normalized numerator words. It will contain the quotient after execution.
+/// @param d           The normalized divisor.
+/// @param reciprocal  The reciprocal of the divisor computed by reciprocal_3by2(d).
+/// @return            The remainder.
+constexpr uint128 udivrem_by2(std::span<uint64_t> u, uint128 d, uint64_t reciprocal) noexcept
+{
+    INTX_REQUIRE(u.size() >= 3);
 
     auto rem = uint128{u[u.size() - 2], u[u.size() - 1]};  // Set the 2 top words as remainder.
     u[u.size() - 1] = u[u.size() - 2] = 0;  // Reset the words being a part of the result quotient.
@@ -1492,6 +2192,15 @@ constexpr uint128 udivrem_by2(std::span<uint64_t> u, uint128 d) noexcept
     return rem;
 }
 
+/// Divides arbitrary long unsigned integer by 128-bit unsigned integer (2 words).
+/// @param u  The normalized numerator words. It will contain the quotient after execution.
+/// @param d  The normalized divisor.
+/// @return   The remainder.
+constexpr uint128 udivrem_by2(std::span<uint64_t> u, uint128 d) noexcept
+{
+    return udivrem_by2(u, d, reciprocal_3by2(d));
+}
+
 /// Add y to x as: x[] += y[].
 constexpr bool add(uint64_t x[], std::span<const uint64_t> y) noexcept
 {
@@ -1504,8 +2213,9 @@ constexpr bool add(uint64_t x[], std::span<const uint64_t> y) noexcept
     return carry;
 }
 
-/// Subtract y multiplied by multiplier from x as: x[] -= multiplier * y[].
-constexpr uint64_t submul(uint64_t x[], std::span<const uint64_t> y, uint64_t multiplier) noexcept
+/// Portable implementation of submul().
+constexpr uint64_t submul_portable(
+    uint64_t x[], std::span<const uint64_t> y, uint64_t multiplier) noexcept
 {
     // OPT: Add MinLen template parameter and unroll first loop iterations.
     INTX_REQUIRE(!y.empty());
@@ -1522,14 +2232,32 @@ constexpr uint64_t submul(uint64_t x[], std::span<const uint64_t> y, uint64_t mu
     return borrow;
 }
 
-constexpr void udivrem_knuth(
-    uint64_t q[], std::span<uint64_t> u, std::span<const uint64_t> d) noexcept
+/// Subtract y multiplied by multiplier from x as: x[] -= multiplier * y[].
+constexpr uint64_t submul(uint64_t x[], std::span<const uint64_t> y, uint64_t multiplier) noexcept
+{
+#if INTX_USE_MULX_ADX
+    if (!std::is_constant_evaluated())
+    {
+        INTX_REQUIRE(!y.empty());
+        return x86_64::submul(x, y.data(), y.size(), multiplier);
+    }
+#endif
+    return submul_portable(x, y, multiplier);
+}
+
+/// Divides arbitrary long unsigned integer by arbitrary long unsigned integer (3+ words).
+/// @param q           The output quotient words.
+/// @param u           The normalized numerator words. It will contain the remainder
+///                    after execution.
+/// @param d           The normalized divisor words.
+/// @param reciprocal  The reciprocal of the 2 top divisor words computed by reciprocal_3by2().
+constexpr void udivrem_knuth(uint64_t q[], std::span<uint64_t> u, std::span<const uint64_t> d,
+    uint64_t reciprocal) noexcept
 {
     INTX_REQUIRE(d.size() >= 3);
     INTX_REQUIRE(u.size() > d.size());
 
     const auto divisor = uint128{d[d.size() - 2], d[d.size() - 1]};
-    const auto reciprocal = reciprocal_3by2(divisor);
     const auto dlen = d.size();
     for (size_t j = u.size() - dlen - 1; true; --j)
     {
@@ -1567,10 +2295,106 @@ constexpr void udivrem_knuth(
     }
 }
 
-}  // namespace internal
-
-template <unsigned M, unsigned N>
-constexpr div_result<uint<M>, uint<N>> udivrem(const uint<M>& u, const uint<N>& v) noexcept
+constexpr void udivrem_knuth(
+    uint64_t q[], std::span<uint64_t> u, std::span<const uint64_t> d) noexcept
+{
+    INTX_REQUIRE(d.size() >= 3);
+    udivrem_knuth(q, u, d, reciprocal_3by2({d[d.size() - 2], d[d.size() - 1]}));
+}
+
+/// The number of divisor words from which the division uses the Burnikel-Ziegler algorithm.
+inline constexpr size_t burnikel_ziegler_threshold = 64;
+
+template <size_t n>
+constexpr void udivrem_2n1n(uint64_t q[], uint64_t a[], const uint64_t b[]) noexcept;
+
+/// Divides the 3h-word a by the normalized 2h-word b (the 3n/2n step of Burnikel-Ziegler).
+/// The quotient must fit in h words. It is stored in q and the 2h-word remainder replaces
+/// the low words of a.
+template <size_t h>
+constexpr void udivrem_3n2n(uint64_t q[], uint64_t a[], const uint64_t b[]) noexcept
+{
+    // Estimate the quotient by dividing the top 2h words of a by the top h words of b.
+    int top = 0;  // The word above the remainder, the remainder can be negative.
+    if (less_n<h>(a + 2 * h, b + h))
+        udivrem_2n1n<h>(q, a + h, b + h);
+    else
+    {
+        // The top words are equal: the quotient is B^h - 1, the remainder is a[h:2h] + b[h:2h].
+        std::fill_n(q, h, ~uint64_t{0});
+        top = add_n<h>(a + h, a + h, b + h);
+    }
+
+    uint64_t d[2 * h];
+    umul_n<h>(d, q, b);
+    top -= sub_n<2 * h>(a, a, d);
+
+    // The estimate is at most 2 too large.
+    while (top < 0)
+    {
+        for (size_t i = 0; q[i]-- == 0; ++i)
+            ;
+        top += add_n<2 * h>(a, a, b);
+    }
+}
+
+/// Divides the 2n-word a by the normalized n-word b with the Burnikel-Ziegler recursion.
+/// The top n words of a must be less than b. The n-word quotient is stored in q
+/// and the n-word remainder replaces the low words of a.
+/// The odd sizes and the sizes below burnikel_ziegler_threshold use udivrem_knuth().
+template <size_t n>
+constexpr void udivrem_2n1n(uint64_t q[], uint64_t a[], const uint64_t b[]) noexcept
+{
+    if constexpr (n < burnikel_ziegler_threshold || n % 2 != 0)
+    {
+        udivrem_knuth(q, {a, 2 * n}, {b, n});
+    }
+    else
+    {
+        constexpr auto h = n / 2;
+        udivrem_3n2n<h>(q + h, a + h, b);
+        udivrem_3n2n<h>(q, a, b);
+    }
+}
+
+/// Burnikel-Ziegler division with the same interface as udivrem_knuth().
+///
+/// The divisor is padded with low zero words to n words so the recursion sizes are known
+/// at compile time; the numerator of at most max_u words is shifted by the same number of words.
+/// The quotient words above the multiple of n are computed by udivrem_knuth(),
+/// then the following n-word blocks by udivrem_2n1n().
+template <size_t n, size_t max_u>
+constexpr void udivrem_burnikel_ziegler(
+    uint64_t q[], std::span<uint64_t> u, std::span<const uint64_t> d) noexcept
+{
+    INTX_REQUIRE(d.size() <= n);
+    INTX_REQUIRE(u.size() <= max_u);
+    INTX_REQUIRE(u.size() > d.size());
+
+    const auto pad = n - d.size();
+    uint64_t b[n]{};
+    std::ranges::copy(d, b + pad);
+    uint64_t a[max_u + n]{};
+    std::ranges::copy(u, a + pad);
+
+    const auto num_quot_words = u.size() - d.size();
+    const auto num_blocks = (num_quot_words - 1) / n;
+    const auto num_top_words = num_quot_words - num_blocks * n;
+    const auto j = num_blocks * n;
+    if (num_top_words == n)
+        udivrem_2n1n<n>(q + j, a + j, b);
+    else
+        udivrem_knuth(q + j, {a + j, n + num_top_words}, {b, n});
+
+    for (size_t i = num_blocks; i-- != 0;)
+        udivrem_2n1n<n>(q + i * n, a + i * n, b);
+
+    std::copy_n(a + pad, d.size(), u.begin());
+}
+}  // namespace internal
+
+template <unsigned M, unsigned N>
+constexpr div_result<uint<M>, uint<N>> udivrem(const uint<M>& u, const uint<N>& v) noexcept
 {
     auto na = internal::normalize(u, v);
 
@@ -1600,7 +2424,20 @@ constexpr div_result<uint<M>, uint<N>> udivrem(const uint<M>& u, const uint<N>&
     }
 
     uint<M> q;
-    internal::udivrem_knuth(&q[0], un, dn);
+    if constexpr (uint<N>::num_words >= internal::burnikel_ziegler_threshold)
+    {
+        // The divisor is padded to the full width so use it only for wide enough divisors.
+        if (dn.size() >= internal::burnikel_ziegler_threshold &&
+            dn.size() * 4 > uint<N>::num_words * 3)
+        {
+            internal::udivrem_burnikel_ziegler<uint<N>::num_words, uint<M>::num_words + 1>(
+                &q[0], un, dn);
+        }
+        else
+            internal::udivrem_knuth(&q[0], un, dn);
+    }
+    else
+        internal::udivrem_knuth(&q[0], un, dn);
 
     uint<N> r;
     auto rw = as_words(r);
@@ -1611,6 +2448,213 @@ constexpr div_result<uint<M>, uint<N>> udivrem(const uint<M>& u, const uint<N>&
     return {q, r};
 }
 
+/// Divider for repeated division by the same divisor.
+///
+/// The divisor normalization and the reciprocal computation are done once in the constructor
+/// so every following division only normalizes the numerator.
+template <unsigned N>
+struct divider
+{
+private:
+    uint<N> divisor_;  ///< The normalized divisor.
+    size_t num_divisor_words_;
+    unsigned shift_;
+    uint64_t reciprocal_;
+
+public:
+    constexpr explicit divider(const uint<N>& d) noexcept
+    {
+        num_divisor_words_ = count_significant_words(d);
+        INTX_REQUIRE(num_divisor_words_ != 0);  // Division by 0.
+
+        shift_ = internal::clz_nonzero(d[num_divisor_words_ - 1]);
+        divisor_ = d << shift_;
+
+        const auto top = num_divisor_words_ - 1;
+        reciprocal_ = (num_divisor_words_ == 1) ?
+                          reciprocal_2by1(divisor_[0]) :
+                          reciprocal_3by2({divisor_[top - 1], divisor_[top]});
+    }
+
+    /// Returns the divisor.
+    constexpr uint<N> divisor() const noexcept { return divisor_ >> shift_; }
+
+    template <unsigned M>
+    constexpr div_result<uint<M>, uint<N>> divrem(const uint<M>& u) const noexcept
+    {
+        constexpr auto num_numerator_words = uint<M>::num_words;
+
+        uint<M + 64> numerator;
+        if (shift_ != 0)
+        {
+            numerator[num_numerator_words] = u[num_numerator_words - 1] >> (64 - shift_);
+            for (size_t i = num_numerator_words - 1; i != 0; --i)
+                numerator[i] = (u[i] << shift_) | (u[i - 1] >> (64 - shift_));
+            numerator[0] = u[0] << shift_;
+        }
+        else
+            numerator = u;
+
+        const auto un_all = as_words(numerator);
+        const auto dn = as_words(divisor_).subspan(0, num_divisor_words_);
+
+        // Count the numerator significant words. Add the top word of the normalized numerator
+        // if it is going to produce a quotient word.
+        size_t m = count_significant_words(u);
+        if (m != 0 && (un_all[m] != 0 || un_all[m - 1] >= dn.back()))
+            ++m;
+
+        if (m <= dn.size())
+            return {0, static_cast<uint<N>>(u)};
+
+        const auto un = un_all.subspan(0, m);
+
+        if (dn.size() == 1)
+        {
+            const auto r = internal::udivrem_by1(un, dn[0], reciprocal_);
+            return {static_cast<uint<M>>(numerator), r >> shift_};
+        }
+
+        if (dn.size() == 2)
+        {
+            const auto r = internal::udivrem_by2(un, {dn[0], dn[1]}, reciprocal_);
+            return {static_cast<uint<M>>(numerator), r >> shift_};
+        }
+
+        uint<M> q;
+        internal::udivrem_knuth(&q[0], un, dn, reciprocal_);
+
+        uint<N> r;
+        const auto n = dn.size();
+        for (size_t i = 0; i < n - 1; ++i)
+            r[i] = shift_ ? (un[i] >> shift_) | (un[i + 1] << (64 - shift_)) : un[i];
+        r[n - 1] = un[n - 1] >> shift_;
+        return {q, r};
+    }
+
+    template <unsigned M>
+    constexpr uint<M> quot(const uint<M>& u) const noexcept
+    {
+        return divrem(u).quot;
+    }
+
+    template <unsigned M>
+    constexpr uint<N> rem(const uint<M>& u) const noexcept
+    {
+        return divrem(u).rem;
+    }
+};
+
+/// Divider by a compile-time constant.
+///
+/// All the constants are computed in the consteval constructor. For the single-word and two-word
+/// divisors the division is a chain of udivrem_2by1() or udivrem_3by2() with the constant
+/// reciprocal. For the wider divisors the quotient is computed by the multiplication by
+/// the "magic" constant as in the Figure 4.1 from "Division by Invariant Integers using
+/// Multiplication".
+template <unsigned N>
+struct constant_divider
+{
+private:
+    uint<N> divisor_;
+    uint<N> magic_;  ///< The multiplier for the divisors wider than 2 words.
+    uint128 normalized_divisor_;
+    uint64_t reciprocal_ = 0;
+    unsigned shift_ = 0;
+    unsigned num_divisor_words_ = 0;
+
+public:
+    consteval explicit constant_divider(const uint<N>& d) noexcept : divisor_{d}
+    {
+        INTX_REQUIRE(d != 0);  // Division by 0.
+
+        num_divisor_words_ = count_significant_words(d);
+        if (num_divisor_words_ == 1)
+        {
+            shift_ = clz(d[0]);
+            normalized_divisor_ = d[0] << shift_;
+            reciprocal_ = reciprocal_2by1(normalized_divisor_[0]);
+        }
+        else if (num_divisor_words_ == 2)
+        {
+            shift_ = clz(d[1]);
+            normalized_divisor_ = uint128{d[0], d[1]} << shift_;
+            reciprocal_ = reciprocal_3by2(normalized_divisor_);
+        }
+        else
+        {
+            // Use l = ⌈log2(d)⌉ as the shift.
+            // The magic m = ⌊2^N · (2^l - d) / d⌋ + 1 fits N bits.
+            shift_ = bit_width(d - 1);
+            uint<2 * N> numerator;
+            const auto t = (uint<N>{1} << shift_) - d;
+            for (size_t i = 0; i < uint<N>::num_words; ++i)
+                numerator[uint<N>::num_words + i] = t[i];
+            magic_ = static_cast<uint<N>>(udivrem(numerator, d).quot) + 1;
+        }
+    }
+
+    /// Returns the divisor.
+    constexpr const uint<N>& divisor() const noexcept { return divisor_; }
+
+    constexpr div_result<uint<N>> divrem(const uint<N>& x) const noexcept
+    {
+        constexpr auto num_words = uint<N>::num_words;
+
+        if (num_divisor_words_ == 1)
+        {
+            const auto d = normalized_divisor_[0];
+            const auto rsh = (64 - shift_) % 64;
+            const auto rsh_mask = uint64_t{shift_ == 0} - 1;
+
+            uint<N> q;
+            auto r = (x[num_words - 1] >> rsh) & rsh_mask;
+            for (size_t i = num_words; i != 0; --i)
+            {
+                const auto lo = (i > 1) ? (x[i - 2] >> rsh) & rsh_mask : 0;
+                const auto u = (x[i - 1] << shift_) | lo;
+                std::tie(q[i - 1], r) = udivrem_2by1({u, r}, d, reciprocal_);
+            }
+            return {q, r >> shift_};
+        }
+
+        if (num_divisor_words_ == 2)
+        {
+            const auto u = uint<N + 64>{x} << shift_;
+
+            uint<N> q;
+            uint128 r{u[num_words - 1], u[num_words]};
+            for (size_t i = num_words - 1; i != 0; --i)
+            {
+                std::tie(q[i - 1], r) =
+                    udivrem_3by2(r[1], r[0], u[i - 1], normalized_divisor_, reciprocal_);
+            }
+            return {q, uint<N>{r >> shift_}};
+        }
+
+        const auto p = umul(magic_, x);
+        uint<N> t;
+        for (size_t i = 0; i < num_words; ++i)
+            t[i] = p[num_words + i];
+        const auto q = (t + ((x - t) >> 1)) >> (shift_ - 1);
+        return {q, x - q * divisor_};
+    }
+
+    constexpr uint<N> quot(const uint<N>& x) const noexcept { return divrem(x).quot; }
+
+    constexpr uint<N> rem(const uint<N>& x) const noexcept { return divrem(x).rem; }
+};
+
+/// Division by the compile-time constant D.
+///
+/// The D must be an integral constant. For wider divisors use the constant_divider directly.
+template <auto D, unsigned N>
+constexpr div_result<uint<N>> udivrem_const(const uint<N>& x) noexcept
+{
+    constexpr constant_divider<N> d{uint<N>{D}};
+    return d.divrem(x);
+}
+
 template <unsigned N>
 constexpr div_result<uint<N>> sdivrem(const uint<N>& u, const uint<N>& v) noexcept
 {
@@ -1628,60 +2672,1374 @@ constexpr div_result<uint<N>> sdivrem(const uint<N>& u, const uint<N>& v) noexce
     return {q_is_neg ? -res.quot : res.quot, u_is_neg ? -res.rem : res.rem};
 }
 
-constexpr uint256 bswap(const uint256& x) noexcept
+/// The rounding mode of muldiv().
+enum class rounding : uint8_t
 {
-    return {bswap(x[3]), bswap(x[2]), bswap(x[1]), bswap(x[0])};
+    floor,  ///< Round down (truncate).
+    ceil,   ///< Round up.
+};
+
+/// Computes a·b/c with the full precision of the 2N-bit product a·b.
+///
+/// The product is divided by the N-bit divisor directly, without widening it.
+/// The carry flag of the result is set if the quotient does not fit N bits or c is 0.
+/// The value is 0 in this case.
+template <unsigned N>
+constexpr result_with_carry<uint<N>> muldiv(
+    const uint<N>& a, const uint<N>& b, const uint<N>& c, rounding mode = rounding::floor) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    if (c == 0)
+        return {0, true};
+
+    const auto p = umul(a, b);
+
+    // The quotient fits N bits iff the high half of the product is less than the divisor.
+    uint<N> p_hi;
+    for (size_t i = 0; i < num_words; ++i)
+        p_hi[i] = p[num_words + i];
+    if (p_hi >= c)
+        return {0, true};
+
+    auto na = internal::normalize(p, c);
+    const auto nw = as_words(na.numerator);
+    const auto un = nw.subspan(0, na.num_numerator_words);
+    const auto dn = as_words(na.divisor).subspan(0, na.num_divisor_words);
+
+    // The remainder is nonzero iff the normalized remainder is nonzero.
+    uint<N> q;
+    bool has_rem = false;
+    if (un.size() <= dn.size())
+    {
+        q = 0;
+        has_rem = p != 0;
+    }
+    else if (dn.size() == 1)
+    {
+        has_rem = internal::udivrem_by1(un, dn[0]) != 0;
+        for (size_t i = 0; i < num_words; ++i)
+            q[i] = nw[i];
+    }
+    else if (dn.size() == 2)
+    {
+        has_rem = internal::udivrem_by2(un, {dn[0], dn[1]}) != 0;
+        for (size_t i = 0; i < num_words; ++i)
+            q[i] = nw[i];
+    }
+    else
+    {
+        // The quotient fits num_words words because p_hi < c, but the normalized numerator
+        // may have the additional top word producing the zero quotient digit.
+        uint64_t qw[num_words + 1]{};
+        internal::udivrem_knuth(qw, un, dn);
+        for (size_t i = 0; i < num_words; ++i)
+            q[i] = qw[i];
+        for (size_t i = 0; i < dn.size(); ++i)
+            has_rem |= un[i] != 0;
+    }
+
+    if (mode == rounding::ceil && has_rem)
+    {
+        const auto [r, carry] = addc(q, uint<N>{1});
+        return {carry ? uint<N>{0} : r, carry};
+    }
+    return {q, false};
+}
+
+namespace internal
+{
+/// The pairs of decimal digits "00" to "99".
+inline constexpr char dec_digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/// The digits of the bases up to 36.
+inline constexpr char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+/// Writes the digits of x in the base being a power of 2 backwards, ending at the end.
+/// Returns the pointer to the first digit.
+template <unsigned N>
+constexpr char* to_chars_pow2(char* end, const uint<N>& x, unsigned digit_bits) noexcept
+{
+    const auto mask = (uint64_t{1} << digit_bits) - 1;
+    const auto num_bits = static_cast<unsigned>(N - clz(x));
+    auto p = end;
+    for (unsigned pos = 0; pos < num_bits; pos += digit_bits)
+    {
+        const auto i = pos / 64;
+        const auto b = pos % 64;
+        auto d = x[i] >> b;
+        if (b + digit_bits > 64 && i + 1 < uint<N>::num_words)
+            d |= x[i + 1] << (64 - b);
+        *--p = digits[d & mask];
+    }
+    return p;
 }
 
+/// Writes the digits of x in the base backwards, ending at the end.
+/// Returns the pointer to the first digit.
+///
+/// The chunks of k digits are divided off with the largest power of the base base^k fitting
+/// a single word, using udivrem_by1(). The digits of the chunks are produced by the cheap
+/// single-word divisions, for the base 10 two at a time from the table of digit pairs.
 template <unsigned N>
-constexpr uint<N> bswap(const uint<N>& x) noexcept
+constexpr char* to_chars_chunked(char* end, const uint<N>& x, unsigned base) noexcept
 {
     constexpr auto num_words = uint<N>::num_words;
-    uint<N> z;
+
+    uint64_t chunk_divisor = base;
+    unsigned chunk_digits = 1;
+    while (chunk_divisor <= ~uint64_t{0} / base)
+    {
+        chunk_divisor *= base;
+        ++chunk_digits;
+    }
+    const auto shift = clz_nonzero(chunk_divisor);
+    const auto d = chunk_divisor << shift;
+    const auto reciprocal = reciprocal_2by1(d);
+
+    uint64_t u[num_words + 1]{};
     for (size_t i = 0; i < num_words; ++i)
-        z[num_words - 1 - i] = bswap(x[i]);
-    return z;
+        u[i] = x[i];
+    auto n = static_cast<size_t>(count_significant_words(x));
+
+    auto p = end;
+    while (true)
+    {
+        uint64_t chunk = 0;
+        if (n == 1 && u[0] < chunk_divisor)
+        {
+            chunk = u[0];
+            n = 0;
+        }
+        else if (n != 0)
+        {
+            // Normalize the numerator in place and divide.
+            u[n] = shift != 0 ? u[n - 1] >> (64 - shift) : 0;
+            for (size_t i = n - 1; i != 0; --i)
+                u[i] = shift != 0 ? (u[i] << shift) | (u[i - 1] >> (64 - shift)) : u[i];
+            u[0] <<= shift;
+
+            chunk = udivrem_by1({u, n + 1}, d, reciprocal) >> shift;
+            while (n != 0 && u[n - 1] == 0)
+                --n;
+        }
+
+        // The last chunk (the most significant) is written without leading zeros.
+        const auto last = n == 0;
+        auto num_digits = chunk_digits;
+        if (base == 10)
+        {
+            for (; num_digits >= 2 && (!last || chunk >= 10); num_digits -= 2)
+            {
+                const auto pair = &dec_digit_pairs[2 * (chunk % 100)];
+                chunk /= 100;
+                *--p = pair[1];
+                *--p = pair[0];
+            }
+        }
+        for (; num_digits != 0 && (!last || chunk != 0); --num_digits)
+        {
+            *--p = digits[chunk % base];
+            chunk /= base;
+        }
+
+        if (last)
+            return p;
+    }
 }
+}  // namespace internal
 
+/// Converts x to the string of digits in the base (2 to 36), with the lowercase letters.
+///
+/// Writes to the range [first, last) without the null terminator and never allocates.
+/// Returns the pointer past the last written character, or last and std::errc::value_too_large
+/// if the range is too small (the content of the range is then unspecified).
+template <unsigned N>
+constexpr std::to_chars_result to_chars(char* first, char* last, const uint<N>& x, int base = 10)
+{
+    INTX_REQUIRE(base >= 2 && base <= 36);
 
-constexpr uint256 addmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
+    if (x == 0)
+    {
+        if (first == last)
+            return {last, std::errc::value_too_large};
+        *first = '0';
+        return {first + 1, std::errc{}};
+    }
+
+    // The digits are written backwards to the buffer big enough for the base 2.
+    char buffer[N];
+    const auto end = buffer + N;
+    const auto b = static_cast<unsigned>(base);
+    const auto digit_bits = static_cast<unsigned>(std::countr_zero(b));
+    const auto begin = std::has_single_bit(b) ? internal::to_chars_pow2(end, x, digit_bits) :
+                                                internal::to_chars_chunked(end, x, b);
+
+    const auto size = end - begin;
+    if (last - first < size)
+        return {last, std::errc::value_too_large};
+    return {std::copy(begin, end, first), std::errc{}};
+}
+
+template <unsigned N>
+inline std::string to_string(const uint<N>& x, int base = 10)
 {
-    // Fast path for mod >= 2^192, with x and y at most slightly bigger than mod.
-    // This is always the case when x and y are already reduced modulo mod.
-    // Based on https://github.com/holiman/uint256/pull/86.
-    if ((mod[3] != 0) && (x[3] <= mod[3]) && (y[3] <= mod[3]))
+    if (base < 2 || base > 36)
+        throw_<std::invalid_argument>("invalid base");
+
+    char buffer[N];
+    const auto r = to_chars(buffer, buffer + N, x, base);
+    return {buffer, r.ptr};
+}
+
+template <unsigned N>
+inline std::string hex(const uint<N>& x)
+{
+    return to_string(x, 16);
+}
+
+namespace internal
+{
+/// Returns the value of the digit character in the bases up to 36 (both letter cases),
+/// or 0xff for invalid characters.
+constexpr uint8_t digit_value(char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+        return static_cast<uint8_t>(c - '0');
+    if (c >= 'a' && c <= 'z')
+        return static_cast<uint8_t>(c - ('a' - 10));
+    if (c >= 'A' && c <= 'Z')
+        return static_cast<uint8_t>(c - ('A' - 10));
+    return 0xff;
+}
+
+/// Computes x = x·m + a. Returns true on overflow (x is then unspecified).
+template <unsigned N>
+constexpr bool mul_add(uint<N>& x, uint64_t m, uint64_t a) noexcept
+{
+    auto carry = a;
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+    {
+        const auto p = umul(x[i], m) + carry;
+        x[i] = p[0];
+        carry = p[1];
+    }
+    return carry != 0;
+}
+
+/// Returns the end of the digits prefix of [first, last) in the base.
+constexpr const char* scan_digits(const char* first, const char* last, unsigned base) noexcept
+{
+    auto p = first;
+    if (base <= 10)
+    {
+        while (p != last && static_cast<unsigned char>(*p - '0') < base)
+            ++p;
+        return p;
+    }
+    while (p != last && digit_value(*p) < base)
+        ++p;
+    return p;
+}
+
+/// Decodes the 16 valid hex digits to the word (the first digit is the most significant).
+constexpr uint64_t decode_hex_word(const char* s) noexcept
+{
+#if INTX_HAS_SSE2
+    if (!std::is_constant_evaluated())
+    {
+        // Map the digits to the values: the '0'-'9' are below 0x40, the letters above.
+        const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+        const auto is_letter = _mm_cmpgt_epi8(c, _mm_set1_epi8(0x40));
+        const auto v = _mm_add_epi8(_mm_and_si128(c, _mm_set1_epi8(0x0f)),
+            _mm_and_si128(is_letter, _mm_set1_epi8(9)));
+
+        // Merge the pairs of nibbles to bytes and pack the bytes.
+        const auto bytes = _mm_and_si128(
+            _mm_or_si128(_mm_slli_epi16(v, 4), _mm_srli_epi16(v, 8)), _mm_set1_epi16(0xff));
+        const auto packed = _mm_packus_epi16(bytes, bytes);
+        return bswap(static_cast<uint64_t>(_mm_cvtsi128_si64(packed)));
+    }
+#endif
+    uint64_t w = 0;
+    for (size_t i = 0; i < 16; ++i)
+        w = (w << 4) | digit_value(s[i]);
+    return w;
+}
+
+/// Returns the end of the hex digits prefix of [first, last).
+constexpr const char* scan_hex_digits(const char* first, const char* last) noexcept
+{
+    auto p = first;
+#if INTX_HAS_SSE2
+    if (!std::is_constant_evaluated())
+    {
+        // Check 16 characters at a time: the digit or the letter a-f in any case.
+        for (; last - p >= 16; p += 16)
+        {
+            const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const auto lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+            const auto is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+            const auto is_letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+            const auto valid =
+                static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)));
+            if (valid != 0xffff)
+                return p + std::countr_one(valid);
+        }
+    }
+#endif
+    while (p != last && digit_value(*p) < 16)
+        ++p;
+    return p;
+}
+
+/// Parses the hex digits [first, last) by assembling the whole words from the end.
+template <unsigned N>
+constexpr bool from_hex_digits(const char* first, const char* last, uint<N>& x) noexcept
+{
+    if (static_cast<size_t>(last - first) > N / 4)
+        return false;
+
+    x = 0;
+    for (size_t i = 0; last != first; ++i)
+    {
+        const auto begin = last - first >= 16 ? last - 16 : first;
+        uint64_t w = 0;
+        if (last - begin == 16)
+            w = decode_hex_word(begin);
+        else
+        {
+            for (auto p = begin; p != last; ++p)
+                w = (w << 4) | digit_value(*p);
+        }
+        x[i] = w;
+        last = begin;
+    }
+    return true;
+}
+
+/// Parses 8 valid decimal digits at once (SWAR): the adjacent digits, then pairs and quads
+/// are combined by multiplications of the whole word.
+inline uint64_t parse_8_dec_digits(const char* s) noexcept
+{
+    uint64_t v;
+    std::memcpy(&v, s, sizeof(v));
+    if constexpr (std::endian::native == std::endian::big)
+        v = bswap(v);
+    v -= 0x3030303030303030;
+    v = (v * 10) + (v >> 8);
+    constexpr uint64_t mask = 0x000000ff000000ff;
+    constexpr uint64_t mul1 = 100 + (uint64_t{1000000} << 32);
+    constexpr uint64_t mul2 = 1 + (uint64_t{10000} << 32);
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+}
+
+/// Parses the digits [first, last) in the base in chunks of k digits accumulated in a word,
+/// where k is the max number of digits such that base^k fits the word (19 for decimal).
+/// Each chunk costs a single multiply-add of the full value.
+template <unsigned N>
+[[gnu::always_inline]] constexpr bool from_chars_chunked(
+    const char* first, const char* last, uint<N>& x, unsigned base) noexcept
+{
+    uint64_t chunk_multiplier = base;
+    size_t chunk_digits = 1;
+    while (chunk_multiplier <= ~uint64_t{0} / base)
+    {
+        chunk_multiplier *= base;
+        ++chunk_digits;
+    }
+
+    x = 0;
+    // The first chunk is the shorter one so the full chunks follow.
+    auto n = static_cast<size_t>(last - first) % chunk_digits;
+    if (n == 0)
+        n = chunk_digits;
+    for (auto p = first; p != last; n = chunk_digits)
+    {
+        uint64_t chunk = 0;
+        uint64_t multiplier = 1;
+        const auto end = p + n;
+        if (base == 10 && !std::is_constant_evaluated())
+        {
+            for (; end - p >= 8; p += 8)
+            {
+                chunk = chunk * 100000000 + parse_8_dec_digits(p);
+                multiplier *= 100000000;
+            }
+        }
+        for (; p != end; ++p)
+        {
+            chunk = chunk * base + (base <= 10 ? static_cast<uint8_t>(*p - '0') : digit_value(*p));
+            multiplier *= base;
+        }
+        if (mul_add(x, multiplier, chunk))
+            return false;
+    }
+    return true;
+}
+}  // namespace internal
+
+/// Parses the digits in the base (2 to 36) from [first, last) to the value, as std::from_chars().
+///
+/// Does not throw and does not accept any prefix or sign. The letters of both cases are accepted.
+/// Returns the pointer past the last digit and std::errc{} on success,
+/// std::errc::invalid_argument if there are no digits (ptr is then first) or
+/// std::errc::result_out_of_range if the number does not fit the type. On errors the value
+/// is not modified.
+template <unsigned N>
+constexpr std::from_chars_result from_chars(
+    const char* first, const char* last, uint<N>& value, int base = 10) noexcept
+{
+    INTX_REQUIRE(base >= 2 && base <= 36);
+    const auto b = static_cast<unsigned>(base);
+
+    const auto end = b == 16 ? internal::scan_hex_digits(first, last) :
+                               internal::scan_digits(first, last, b);
+    if (end == first)
+        return {first, std::errc::invalid_argument};
+
+    // Skip the leading zeros.
+    auto p = first;
+    while (p != end && *p == '0')
+        ++p;
+
+    // The decimal parsing is inlined with the constant base.
+    uint<N> x;
+    bool ok = false;
+    if (b == 16)
+        ok = internal::from_hex_digits(p, end, x);
+    else if (b == 10)
+        ok = internal::from_chars_chunked(p, end, x, 10);
+    else
+        ok = internal::from_chars_chunked(p, end, x, b);
+    if (!ok)
+        return {end, std::errc::result_out_of_range};
+
+    value = x;
+    return {end, std::errc{}};
+}
+
+/// Parses the decimal or the 0x-prefixed hex string.
+/// Throws std::invalid_argument on invalid digits and otherwise std::out_of_range if the
+/// number does not fit the type. Unlike from_chars(), the leading zeros count towards the
+/// limit: the string must not have more digits than the max value of the type.
+template <typename Int>
+constexpr Int from_string(const char* str)
+{
+    auto first = str;
+    int base = 10;
+    auto max_digits = size_t{std::numeric_limits<Int>::digits10} + 1;
+    if (first[0] == '0' && (first[1] == 'x' || first[1] == 'X'))
+    {
+        first += 2;
+        base = 16;
+        max_digits = sizeof(Int) * 2;
+    }
+    const auto last = first + std::char_traits<char>::length(first);
+
+    auto x = Int{};
+    if (first == last)
+        return x;
+    const auto digits_end = base == 16 ? internal::scan_hex_digits(first, last) :
+                                         internal::scan_digits(first, last, 10);
+    if (digits_end != last)
+        throw_<std::invalid_argument>("invalid digit");
+    if (static_cast<size_t>(last - first) > max_digits)
+        throw_<std::out_of_range>(str);
+
+    if (from_chars(first, last, x, base).ec != std::errc{})
+        throw_<std::out_of_range>(str);
+    return x;
+}
+
+template <typename Int>
+constexpr Int from_string(const std::string& s)
+{
+    return from_string<Int>(s.c_str());
+}
+
+namespace internal
+{
+/// Encodes the 16 bytes to 32 lowercase hex digits.
+inline void hex_encode_16(char* out, const uint8_t* bytes) noexcept
+{
+#if INTX_HAS_SSE2
+    const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    const auto low_nibble_mask = _mm_set1_epi8(0x0f);
+    const auto hi = _mm_and_si128(_mm_srli_epi16(b, 4), low_nibble_mask);
+    const auto lo = _mm_and_si128(b, low_nibble_mask);
+    auto n0 = _mm_unpacklo_epi8(hi, lo);
+    auto n1 = _mm_unpackhi_epi8(hi, lo);
+    #ifdef __SSSE3__
+    // Look up the digits with pshufb.
+    const auto table = _mm_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    n0 = _mm_shuffle_epi8(table, n0);
+    n1 = _mm_shuffle_epi8(table, n1);
+    #else
+    // Add '0' to all nibbles and the distance to 'a' to the nibbles above 9.
+    const auto to_ascii = [](__m128i n) noexcept {
+        const auto is_letter = _mm_cmpgt_epi8(n, _mm_set1_epi8(9));
+        const auto offset = _mm_and_si128(is_letter, _mm_set1_epi8('a' - '0' - 10));
+        return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), offset);
+    };
+    n0 = to_ascii(n0);
+    n1 = to_ascii(n1);
+    #endif
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), n0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), n1);
+#else
+    for (size_t i = 0; i < 16; ++i)
+    {
+        out[2 * i] = digits[bytes[i] >> 4];
+        out[2 * i + 1] = digits[bytes[i] & 0xf];
+    }
+#endif
+}
+}  // namespace internal
+
+/// Converts x to the minimal 0x-prefixed hex form (as the Ethereum JSON-RPC quantity),
+/// e.g. 0x0, 0x1a. Returns std::errc::value_too_large if the range is too small.
+template <unsigned N>
+inline std::to_chars_result to_hex_chars(char* first, char* last, const uint<N>& x) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    const auto num_digits = std::max((N - clz(x) + 3) / 4, 1u);
+    if (last - first < static_cast<ptrdiff_t>(num_digits + 2))
+        return {last, std::errc::value_too_large};
+
+    // Encode all the bytes in the big-endian order with the padding to 16 bytes.
+    constexpr size_t num_padded_bytes = (N / 8 + 15) / 16 * 16;
+    uint8_t bytes[num_padded_bytes]{};
+    for (size_t i = 0; i < num_words; ++i)
+    {
+        const auto w = bswap(x[num_words - 1 - i]);
+        std::memcpy(&bytes[num_padded_bytes - num_words * 8 + i * 8], &w, sizeof(w));
+    }
+    char digits[2 * num_padded_bytes];
+    for (size_t i = 0; i < num_padded_bytes; i += 16)
+        internal::hex_encode_16(&digits[2 * i], &bytes[i]);
+
+    *first++ = '0';
+    *first++ = 'x';
+    return {std::copy_n(std::end(digits) - num_digits, num_digits, first), std::errc{}};
+}
+
+/// Converts the values to the minimal 0x-prefixed hex forms written one after another
+/// with the separator between them, e.g. 0x1,0xff for the separator ",".
+/// Returns std::errc::value_too_large if the range is too small.
+template <unsigned N>
+inline std::to_chars_result to_hex_chars(char* first, char* last,
+    std::span<const uint<N>> values, std::string_view separator = ",") noexcept
+{
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (i != 0)
+        {
+            if (last - first < static_cast<ptrdiff_t>(separator.size()))
+                return {last, std::errc::value_too_large};
+            first = std::copy(separator.begin(), separator.end(), first);
+        }
+        const auto r = to_hex_chars(first, last, values[i]);
+        if (r.ec != std::errc{})
+            return r;
+        first = r.ptr;
+    }
+    return {first, std::errc{}};
+}
+
+/// Parses the hex number with the optional 0x prefix, e.g. the Ethereum JSON-RPC quantity.
+/// The results are as of from_chars(). The prefix without digits, e.g. "0x",
+/// is std::errc::invalid_argument.
+template <unsigned N>
+constexpr std::from_chars_result from_hex_chars(
+    const char* first, const char* last, uint<N>& value) noexcept
+{
+    auto p = first;
+    if (last - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        p += 2;
+    const auto r = from_chars(p, last, value, 16);
+    if (r.ec == std::errc::invalid_argument)
+        return {first, r.ec};
+    return r;
+}
+
+namespace internal
+{
+/// The standard format specification of an integer: [[fill]align][#][0][width][type].
+/// The type is one of d, x, X, b, B, o. The dynamic width ({:{}}) is not supported.
+struct format_spec
+{
+    char fill = ' ';
+    char align = '\0';  ///< One of '<', '>', '^' or '\0' for the default (right).
+    bool alternate = false;
+    bool zero_pad = false;
+    unsigned width = 0;
+    char type = 'd';
+
+    /// Parses the specification up to the closing '}' or the end of the input.
+    /// Returns the pointer to the first not parsed character or nullptr if the spec is invalid.
+    constexpr const char* parse(const char* first, const char* last) noexcept
+    {
+        const auto is_align = [](char c) noexcept { return c == '<' || c == '>' || c == '^'; };
+
+        auto p = first;
+        if (last - p >= 2 && is_align(p[1]) && p[0] != '{' && p[0] != '}')
+        {
+            fill = p[0];
+            align = p[1];
+            p += 2;
+        }
+        else if (p != last && is_align(*p))
+            align = *p++;
+
+        if (p != last && *p == '#')
+        {
+            alternate = true;
+            ++p;
+        }
+        if (p != last && *p == '0')
+        {
+            zero_pad = true;
+            ++p;
+        }
+        for (; p != last && *p >= '0' && *p <= '9'; ++p)
+        {
+            width = width * 10 + static_cast<unsigned>(*p - '0');
+            if (width > 0xffff)
+                return nullptr;
+        }
+
+        if (p != last && *p != '}')
+        {
+            switch (*p)
+            {
+            case 'd':
+            case 'x':
+            case 'X':
+            case 'b':
+            case 'B':
+            case 'o':
+                type = *p++;
+                break;
+            default:
+                return nullptr;
+            }
+        }
+
+        if (p != last && *p != '}')
+            return nullptr;
+        return p;
+    }
+};
+
+/// Formats the value according to the spec to the output iterator.
+/// The digits are produced in a stack buffer so nothing is allocated.
+template <typename OutputIt, unsigned N>
+constexpr OutputIt format_to(OutputIt out, const uint<N>& x, const format_spec& spec)
+{
+    int base = 10;
+    const char* prefix = "";
+    switch (spec.type)
+    {
+    case 'x':
+        base = 16;
+        prefix = "0x";
+        break;
+    case 'X':
+        base = 16;
+        prefix = "0X";
+        break;
+    case 'b':
+        base = 2;
+        prefix = "0b";
+        break;
+    case 'B':
+        base = 2;
+        prefix = "0B";
+        break;
+    case 'o':
+        base = 8;
+        prefix = x != 0 ? "0" : "";
+        break;
+    default:
+        break;
+    }
+    if (!spec.alternate)
+        prefix = "";
+
+    // The base 2 gives the longest representation.
+    char text[N];
+    const auto text_end = to_chars(text, text + N, x, base).ptr;
+    if (spec.type == 'X')
+    {
+        for (auto p = text; p != text_end; ++p)
+        {
+            if (*p >= 'a')
+                *p = static_cast<char>(*p - 'a' + 'A');
+        }
+    }
+
+    const auto prefix_size = std::char_traits<char>::length(prefix);
+    const auto size = prefix_size + static_cast<size_t>(text_end - text);
+    const auto padding = spec.width > size ? spec.width - size : 0;
+
+    // The zero padding goes between the prefix and the digits and is ignored with the alignment.
+    const auto zeros = (spec.zero_pad && spec.align == '\0') ? padding : 0;
+    const auto fill = padding - zeros;
+    const auto fill_left = spec.align == '<' ? 0 : spec.align == '^' ? fill / 2 : fill;
+
+    out = std::fill_n(out, fill_left, spec.fill);
+    out = std::copy(prefix, prefix + prefix_size, out);
+    out = std::fill_n(out, zeros, '0');
+    out = std::copy(text, text_end, out);
+    return std::fill_n(out, fill - fill_left, spec.fill);
+}
+}  // namespace internal
+
+/// Inserts the value into the stream respecting the base (dec, hex, oct), showbase, uppercase,
+/// width, fill and adjustment flags. The text is produced in a stack buffer.
+template <typename Traits, unsigned N>
+std::basic_ostream<char, Traits>& operator<<(std::basic_ostream<char, Traits>& os, const uint<N>& x)
+{
+    using ostream = std::basic_ostream<char, Traits>;
+
+    const auto flags = os.flags();
+    const auto basefield = flags & ostream::basefield;
+
+    internal::format_spec spec;
+    if (basefield == ostream::hex)
+        spec.type = (flags & ostream::uppercase) ? 'X' : 'x';
+    else if (basefield == ostream::oct)
+        spec.type = 'o';
+    // Like for the built-in types, the base prefix is not shown for zero.
+    spec.alternate = (flags & ostream::showbase) && x != 0;
+
+    // The octal with the prefix is the longest form, 1 digit more than digits10 for decimal.
+    constexpr auto buffer_size = (N + 2) / 3 + 1;
+    static_assert(buffer_size > std::numeric_limits<uint<N>>::digits10 + 1);
+    char buffer[buffer_size];
+    const auto end = internal::format_to(buffer, x, spec);
+
+    // Insert as a string to get the width, fill and adjustment applied by the stream.
+    return os << std::string_view{buffer, static_cast<size_t>(end - buffer)};
+}
+
+constexpr uint256 bswap(const uint256& x) noexcept
+{
+    return {bswap(x[3]), bswap(x[2]), bswap(x[1]), bswap(x[0])};
+}
+
+template <unsigned N>
+constexpr uint<N> bswap(const uint<N>& x) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+    uint<N> z;
+    for (size_t i = 0; i < num_words; ++i)
+        z[num_words - 1 - i] = bswap(x[i]);
+    return z;
+}
+
+
+constexpr uint256 addmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    // Fast path for mod >= 2^192, with x and y at most slightly bigger than mod.
+    // This is always the case when x and y are already reduced modulo mod.
+    // Based on https://github.com/holiman/uint256/pull/86.
+    if ((mod[3] != 0) && (x[3] <= mod[3]) && (y[3] <= mod[3]))
+    {
+        // Normalize x in case it is bigger than mod.
+        auto xn = x;
+        auto xd = subc(x, mod);
+        if (!xd.carry)
+            xn = xd.value;
+
+        // Normalize y in case it is bigger than mod.
+        auto yn = y;
+        auto yd = subc(y, mod);
+        if (!yd.carry)
+            yn = yd.value;
+
+        auto a = addc(xn, yn);
+        auto av = a.value;
+        auto b = subc(av, mod);
+        auto bv = b.value;
+        if (a.carry || !b.carry)
+            return bv;
+        return av;
+    }
+
+    auto s = addc(x, y);
+    uint<256 + 64> n = s.value;
+    n[4] = s.carry;
+    return udivrem(n, mod).rem;
+}
+
+constexpr uint256 mulmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    return udivrem(umul(x, y), mod).rem;
+}
+
+/// Modular squaring x·x mod m. Cheaper than mulmod(x, x, mod) by using sqr_full().
+constexpr uint256 sqrmod(const uint256& x, const uint256& mod) noexcept
+{
+    return udivrem(sqr_full(x), mod).rem;
+}
+
+namespace internal
+{
+/// Computes the inverse of the odd x modulo 2^64.
+constexpr uint64_t inv_mod_2_64(uint64_t x) noexcept
+{
+    // Newton-Raphson iteration. The initial value is correct for 3 bits.
+    // Each step doubles the number of correct bits.
+    uint64_t inv = x;
+    for (int i = 0; i < 5; ++i)
+        inv *= 2 - x * inv;
+    return inv;
+}
+}  // namespace internal
+
+/// Montgomery modular arithmetic context for a fixed odd modulus m.
+///
+/// The values are kept in the Montgomery form x·R mod m, where R = 2^N. The multiplication
+/// of values in this form does not need division, so it is much cheaper than mulmod()
+/// when many operations are done with the same modulus. All arguments of the arithmetic
+/// methods must be in the Montgomery form and be reduced (less than the modulus).
+template <unsigned N>
+struct montgomery
+{
+    static constexpr auto num_words = uint<N>::num_words;
+
+private:
+    uint<N> mod_;
+    uint<N> r2_;    ///< R^2 mod m.
+    uint64_t inv_;  ///< -m^-1 mod 2^64.
+
+public:
+    constexpr explicit montgomery(const uint<N>& mod) noexcept : mod_{mod}
+    {
+        INTX_REQUIRE((mod[0] & 1) != 0);  // Modulus must be odd.
+
+        inv_ = 0 - internal::inv_mod_2_64(mod[0]);
+
+        const auto r = udivrem(-mod, mod).rem;  // R mod m = (R - m) mod m.
+        r2_ = udivrem(umul(r, r), mod).rem;
+    }
+
+    /// Returns the modulus.
+    constexpr const uint<N>& modulus() const noexcept { return mod_; }
+
+    /// Converts x to the Montgomery form. The x is not required to be reduced.
+    constexpr uint<N> to_mont(const uint<N>& x) const noexcept { return mul(x, r2_); }
+
+    /// Converts x from the Montgomery form.
+    constexpr uint<N> from_mont(const uint<N>& x) const noexcept { return mul(x, uint<N>{1}); }
+
+    /// Montgomery multiplication x·y·R^-1 mod m (CIOS method).
+    constexpr uint<N> mul(const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        uint64_t t[num_words + 2]{};
+        for (size_t i = 0; i < num_words; ++i)
+        {
+            // t += x * y[i]
+            uint64_t k = 0;
+            for (size_t j = 0; j < num_words; ++j)
+            {
+                const auto p = umul(x[j], y[i]) + t[j] + k;
+                t[j] = p[0];
+                k = p[1];
+            }
+            const auto s = addc(t[num_words], k);
+            t[num_words] = s.value;
+            t[num_words + 1] = s.carry;
+
+            // t = (t + q * m) / 2^64, where q is selected to make the lowest word zero.
+            const auto q = t[0] * inv_;
+            k = (umul(q, mod_[0]) + t[0])[1];
+            for (size_t j = 1; j < num_words; ++j)
+            {
+                const auto p = umul(q, mod_[j]) + t[j] + k;
+                t[j - 1] = p[0];
+                k = p[1];
+            }
+            const auto u = addc(t[num_words], k);
+            t[num_words - 1] = u.value;
+            t[num_words] = t[num_words + 1] + u.carry;
+        }
+        return reduce_once(t);
+    }
+
+    /// Montgomery squaring x·x·R^-1 mod m.
+    ///
+    /// Computes the full square with sqr_full() and then does the separate Montgomery reduction.
+    constexpr uint<N> sqr(const uint<N>& x) const noexcept
+    {
+        const auto s = sqr_full(x);
+
+        // The window t holds the words i..i+n of the value being reduced.
+        // In each step add q·m, where q is selected to make the lowest word zero,
+        // and shift the window by one word.
+        uint64_t t[num_words + 2]{};
+        for (size_t j = 0; j < num_words; ++j)
+            t[j] = s[j];
+        bool c = false;
+        for (size_t i = 0; i < num_words; ++i)
+        {
+            const auto q = t[0] * inv_;
+            uint64_t k = (umul(q, mod_[0]) + t[0])[1];
+            for (size_t j = 1; j < num_words; ++j)
+            {
+                const auto p = umul(q, mod_[j]) + t[j] + k;
+                t[j - 1] = p[0];
+                k = p[1];
+            }
+            const auto u = addc(s[num_words + i], k, c);
+            t[num_words - 1] = u.value;
+            c = u.carry;
+        }
+        t[num_words] = c;
+        return reduce_once(t);
+    }
+
+    /// Modular addition x + y mod m.
+    constexpr uint<N> add(const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        const auto s = addc(x, y);
+        const auto d = subc(s.value, mod_);
+        return (s.carry || !d.carry) ? d.value : s.value;
+    }
+
+    /// Modular subtraction x - y mod m.
+    constexpr uint<N> sub(const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        const auto d = subc(x, y);
+        return d.carry ? d.value + mod_ : d.value;
+    }
+
+private:
+    /// Converts the (N + 64)-bit value t < 2m to the reduced value t mod m.
+    constexpr uint<N> reduce_once(const uint64_t (&t)[num_words + 2]) const noexcept
+    {
+        uint<N> r;
+        for (size_t i = 0; i < num_words; ++i)
+            r[i] = t[i];
+        const auto d = subc(r, mod_);
+        return (t[num_words] != 0 || !d.carry) ? d.value : r;
+    }
+};
+
+/// Barrett reduction by a fixed arbitrary (also even) modulus.
+///
+/// The modulus m is normalized to d = m·2^s with the top bit set and μ = ⌊(2^2N - 1) / d⌋
+/// is precomputed. For k = N / 64 words the quotient of x by m, equal to the quotient of
+/// u = x·2^s by d, is estimated as q̂ = ⌊⌊u / 2^(N-64)⌋·μ / 2^(N+64)⌋ (Algorithm 14.42 from
+/// "Handbook of Applied Cryptography"). Only the top columns of this product and only
+/// the low k + 1 words of q̂·m are computed. The estimate is at most 2 less than the quotient,
+/// so at most 2 corrections are needed.
+template <unsigned N>
+struct barrett
+{
+    static constexpr auto num_words = uint<N>::num_words;
+
+private:
+    uint<N> mod_;
+    uint<N> v_;  ///< The μ without the implicit top bit.
+    unsigned shift_;
+
+public:
+    constexpr explicit barrett(const uint<N>& mod) noexcept : mod_{mod}, shift_{clz(mod)}
+    {
+        INTX_REQUIRE(mod != 0);  // Division by 0.
+        // The μ is in range [2^N, 2^(N+1)) so the top bit is dropped by the truncation.
+        v_ = static_cast<uint<N>>(udivrem(~uint<2 * N>{0}, mod << shift_).quot);
+    }
+
+    /// Returns the modulus.
+    constexpr const uint<N>& modulus() const noexcept { return mod_; }
+
+    /// Computes x mod m.
+    constexpr uint<N> reduce(const uint<2 * N>& x) const noexcept
+    {
+        uint<N> hi;
+        for (size_t i = 0; i < num_words; ++i)
+            hi[i] = x[num_words + i];
+
+        // The u = x·2^s fits 2N bits unless the top s bits of x are set.
+        // This is never the case for the products of reduced values.
+        // Otherwise, reduce the high half first.
+        if (clz(hi) >= shift_)
+            return reduce_fitting(x);
+
+        auto y = uint<2 * N>{reduce_fitting(uint<2 * N>{hi})} << N;
+        for (size_t i = 0; i < num_words; ++i)
+            y[i] = x[i];
+        return reduce_fitting(y);
+    }
+
+private:
+    /// Computes x mod m. Requires x·2^s < 2^2N.
+    constexpr uint<N> reduce_fitting(const uint<2 * N>& x) const noexcept
+    {
+        constexpr auto k = num_words;
+
+        // The q1 = ⌊u / 2^(N-64)⌋: the top k+1 words of u = x·2^s.
+        const auto word_shift = shift_ / 64;
+        const auto bit_shift = shift_ % 64;
+        uint64_t q1[k + 1];
+        for (size_t i = 0; i <= k; ++i)
+        {
+            const auto j = k - 1 + i;
+            const auto w = j >= word_shift ? x[j - word_shift] : 0;
+            const auto w_prev = j >= word_shift + 1 ? x[j - word_shift - 1] : 0;
+            q1[i] = bit_shift != 0 ? (w << bit_shift) | (w_prev >> (64 - bit_shift)) : w;
+        }
+
+        // The columns k-1 and above of q1·v. The skipped lower columns decrease the estimate
+        // by at most 1 and this is covered by the error bound of 2.
+        uint64_t h[k + 3]{};
+        for (size_t i = 0; i <= k; ++i)
+        {
+            uint64_t c = 0;
+            for (size_t j = (i < k - 1) ? k - 1 - i : 0; j < k; ++j)
+            {
+                const auto p = umul(q1[i], v_[j]) + h[i + j - (k - 1)] + c;
+                h[i + j - (k - 1)] = p[0];
+                c = p[1];
+            }
+            h[i + 1] = c;
+        }
+
+        // Add q1·2^N for the implicit top bit of μ: the lowest word of q1 goes to the column k,
+        // the rest is added to the quotient directly.
+        bool carry = false;
+        std::tie(h[1], carry) = addc(h[1], q1[0]);
+        for (size_t i = 2; i < k + 3; ++i)
+            std::tie(h[i], carry) = addc(h[i], uint64_t{0}, carry);
+
+        uint64_t q[k + 1];
+        carry = false;
+        for (size_t i = 0; i < k; ++i)
+            std::tie(q[i], carry) = addc(h[i + 2], q1[i + 1], carry);
+        q[k] = h[k + 2] + carry;
+
+        // r = (x - q̂·m) mod 2^(N+64). The r is less than 3m.
+        uint64_t r[k + 1];
+        for (size_t i = 0; i <= k; ++i)
+            r[i] = x[i];
+        for (size_t i = 0; i <= k; ++i)
+        {
+            uint64_t c = 0;
+            bool borrow = false;
+            for (size_t j = 0; i + j <= k && j < k; ++j)
+            {
+                const auto p = umul(q[i], mod_[j]) + c;
+                std::tie(r[i + j], borrow) = subc(r[i + j], p[0], borrow);
+                c = p[1];
+            }
+            if (i == 0)
+                r[k] -= c + borrow;
+        }
+
+        for (int n = 0; n < 2; ++n)
+        {
+            uint64_t t[k + 1];
+            bool borrow = false;
+            for (size_t i = 0; i < k; ++i)
+                std::tie(t[i], borrow) = subc(r[i], mod_[i], borrow);
+            std::tie(t[k], borrow) = subc(r[k], uint64_t{0}, borrow);
+            for (size_t i = 0; i <= k; ++i)
+                r[i] = borrow ? r[i] : t[i];
+        }
+
+        uint<N> result;
+        for (size_t i = 0; i < k; ++i)
+            result[i] = r[i];
+        return result;
+    }
+};
+
+/// Modular multiplication using the precomputed Barrett reducer.
+template <unsigned N>
+constexpr uint<N> mulmod(const uint<N>& x, const uint<N>& y, const barrett<N>& mod) noexcept
+{
+    return mod.reduce(umul(x, y));
+}
+
+/// Modular squaring using the precomputed Barrett reducer.
+template <unsigned N>
+constexpr uint<N> sqrmod(const uint<N>& x, const barrett<N>& mod) noexcept
+{
+    return mod.reduce(sqr_full(x));
+}
+
+namespace internal
+{
+/// The maximum sliding window size of powmod().
+inline constexpr unsigned powmod_max_window = 6;
+
+/// Selects the sliding window size for an exponent of the given bit width.
+/// The thresholds balance the precomputation of 2^(w-1) odd powers with the saved
+/// multiplications: roughly bits / (w + 1) for the window of size w.
+constexpr unsigned powmod_window_size(unsigned exp_bits) noexcept
+{
+    constexpr unsigned thresholds[] = {7, 25, 81, 241, 673};
+    unsigned w = 1;
+    for (const auto t : thresholds)
+        w += exp_bits > t;
+    return w;
+}
+
+/// Left-to-right sliding window exponentiation in the domain given by the mul and sqr
+/// operations. The base must be in this domain and one is its identity element.
+template <unsigned N, typename MulFn, typename SqrFn>
+constexpr uint<N> pow_sliding_window(const uint<N>& base, const uint<N>& exp, const uint<N>& one,
+    MulFn mul, SqrFn sqr) noexcept
+{
+    const auto exp_bits = bit_width(exp);
+    const auto w = powmod_window_size(exp_bits);
+
+    // The odd powers base^1, base^3, ..., base^(2^w - 1).
+    uint<N> table[size_t{1} << (powmod_max_window - 1)];
+    table[0] = base;
+    if (w > 1)
+    {
+        const auto base2 = sqr(base);
+        for (size_t i = 1; i < (size_t{1} << (w - 1)); ++i)
+            table[i] = mul(table[i - 1], base2);
+    }
+
+    auto result = one;
+    bool is_one = true;
+    for (auto i = exp_bits; i != 0;)
+    {
+        if (!bit_test(exp, i - 1))
+        {
+            if (!is_one)
+                result = sqr(result);
+            --i;
+            continue;
+        }
+
+        // Take the longest window ending with the set bit.
+        auto len = std::min(w, i);
+        while (!bit_test(exp, i - len))
+            --len;
+        unsigned window = 0;
+        for (auto j = i; j != i - len; --j)
+            window = (window << 1) | unsigned{bit_test(exp, j - 1)};
+
+        if (is_one)
+            result = table[window >> 1];
+        else
+        {
+            for (unsigned j = 0; j < len; ++j)
+                result = sqr(result);
+            result = mul(result, table[window >> 1]);
+        }
+        is_one = false;
+        i -= len;
+    }
+    return result;
+}
+}  // namespace internal
+
+/// Modular exponentiation base^exp mod m.
+///
+/// Odd moduli use the Montgomery form, other moduli the Barrett reduction.
+/// The exponent is scanned from the top with sliding windows, the window size grows
+/// with bit_width(exp).
+template <unsigned N>
+constexpr uint<N> powmod(const uint<N>& base, const uint<N>& exp, const uint<N>& mod) noexcept
+{
+    INTX_REQUIRE(mod != 0);  // Division by 0.
+
+    if ((mod[0] & 1) != 0)
+    {
+        const montgomery<N> m{mod};
+        const auto r = internal::pow_sliding_window(
+            m.to_mont(base), exp, m.to_mont(1),
+            [&m](const uint<N>& x, const uint<N>& y) noexcept { return m.mul(x, y); },
+            [&m](const uint<N>& x) noexcept { return m.sqr(x); });
+        return m.from_mont(r);
+    }
+
+    const barrett<N> b{mod};
+    return internal::pow_sliding_window(
+        base % mod, exp, uint<N>{1} % mod,
+        [&b](const uint<N>& x, const uint<N>& y) noexcept { return mulmod(x, y, b); },
+        [&b](const uint<N>& x) noexcept { return sqrmod(x, b); });
+}
+
+/// Modular exponentiation with the fixed base and modulus using the precomputed comb table.
+///
+/// This is the Lim-Lee fixed-base comb method. The exponent bits are arranged in H rows of
+/// a = ⌈max_exp_bits / H⌉ bits and every row is split into V blocks of b = ⌈a / V⌉ bits.
+/// The table holds V·(2^H - 1) products of the powers base^(2^(r·a + s·b)), one for every
+/// combination of the rows, so the exponentiation needs only b - 1 squarings and at most
+/// V·b multiplications. Bigger H and V make the exponentiation faster for the table memory
+/// (allocated on the heap).
+/// Odd moduli use the Montgomery form, other moduli the Barrett reduction.
+template <unsigned N, unsigned H = 5, unsigned V = 2>
+class fixed_base_powmod
+{
+    static_assert(H >= 1 && H <= 16);
+    static_assert(V >= 1);
+
+    static constexpr size_t row_size = (size_t{1} << H) - 1;
+
+    std::variant<montgomery<N>, barrett<N>> ctx_;
+    uint<N> mod_;
+    unsigned num_cols_;    ///< The number of exponent bits in a row (a).
+    unsigned block_size_;  ///< The number of exponent bits in a block (b).
+
+    /// The combinations of the powers for all V blocks: the entry s·(2^H - 1) + j - 1 is
+    /// the product of base^(2^(r·a + s·b)) for every row r set in j.
+    std::vector<uint<N>> table_;
+
+public:
+    constexpr fixed_base_powmod(
+        const uint<N>& base, const uint<N>& mod, unsigned max_exp_bits = N)
+      : ctx_{make_context(mod)},
+        mod_{mod},
+        num_cols_{(max_exp_bits + H - 1) / H},
+        block_size_{(num_cols_ + V - 1) / V},
+        table_(V * row_size)
+    {
+        INTX_REQUIRE(max_exp_bits != 0 && max_exp_bits <= N);
+        std::visit([this, &base](const auto& ctx) { init_table(ctx, base); }, ctx_);
+    }
+
+    /// Returns the modulus.
+    constexpr const uint<N>& modulus() const noexcept { return mod_; }
+
+    /// Computes base^exp mod m. The exponent must not be wider than max_exp_bits
+    /// rounded up to a multiple of H.
+    constexpr uint<N> pow(const uint<N>& exp) const noexcept
+    {
+        INTX_REQUIRE(bit_width(exp) <= size_t{H} * num_cols_);
+        return std::visit([this, &exp](const auto& ctx) { return pow(ctx, exp); }, ctx_);
+    }
+
+private:
+    static constexpr std::variant<montgomery<N>, barrett<N>> make_context(
+        const uint<N>& mod) noexcept
+    {
+        INTX_REQUIRE(mod != 0);  // Division by 0.
+        if ((mod[0] & 1) != 0)
+            return montgomery<N>{mod};
+        return barrett<N>{mod};
+    }
+
+    template <typename Context>
+    constexpr void init_table(const Context& ctx, const uint<N>& base) noexcept
+    {
+        // The first block: the combinations of g_r = base^(2^(r·a)) with the top row r.
+        auto g = to_domain(ctx, base);
+        for (size_t r = 0; r < H; ++r)
+        {
+            if (r != 0)
+            {
+                for (unsigned i = 0; i < num_cols_; ++i)
+                    g = sqr(ctx, g);
+            }
+            const auto top = size_t{1} << r;
+            table_[top - 1] = g;
+            for (size_t j = top + 1; j < 2 * top; ++j)
+                table_[j - 1] = mul(ctx, table_[j - top - 1], g);
+        }
+
+        // The next blocks are the previous ones raised to 2^b.
+        for (size_t i = row_size; i < table_.size(); ++i)
+        {
+            auto x = table_[i - row_size];
+            for (unsigned k = 0; k < block_size_; ++k)
+                x = sqr(ctx, x);
+            table_[i] = x;
+        }
+    }
+
+    template <typename Context>
+    constexpr uint<N> pow(const Context& ctx, const uint<N>& exp) const noexcept
+    {
+        uint<N> result;
+        bool is_one = true;
+        for (auto k = block_size_; k-- != 0;)
+        {
+            if (!is_one)
+                result = sqr(ctx, result);
+
+            for (auto s = V; s-- != 0;)
+            {
+                // The column of the exponent bits. The last block may be shorter.
+                const auto col = s * block_size_ + k;
+                if (col >= num_cols_)
+                    continue;
+
+                size_t j = 0;
+                for (auto r = H; r-- != 0;)
+                {
+                    const auto bit_index = size_t{r} * num_cols_ + col;
+                    j = (j << 1) | size_t{bit_index < N && bit_test(exp, bit_index)};
+                }
+                if (j == 0)
+                    continue;
+
+                const auto& entry = table_[s * row_size + j - 1];
+                result = is_one ? entry : mul(ctx, result, entry);
+                is_one = false;
+            }
+        }
+        return is_one ? from_domain(ctx, to_domain(ctx, 1)) : from_domain(ctx, result);
+    }
+
+    static constexpr uint<N> to_domain(const montgomery<N>& m, const uint<N>& x) noexcept
+    {
+        return m.to_mont(x);
+    }
+
+    static constexpr uint<N> to_domain(const barrett<N>& b, const uint<N>& x) noexcept
+    {
+        return b.reduce(uint<2 * N>{x});
+    }
+
+    static constexpr uint<N> from_domain(const montgomery<N>& m, const uint<N>& x) noexcept
+    {
+        return m.from_mont(x);
+    }
+
+    static constexpr uint<N> from_domain(const barrett<N>&, const uint<N>& x) noexcept
     {
-        // Normalize x in case it is bigger than mod.
-        auto xn = x;
-        auto xd = subc(x, mod);
-        if (!xd.carry)
-            xn = xd.value;
+        return x;
+    }
 
-        // Normalize y in case it is bigger than mod.
-        auto yn = y;
-        auto yd = subc(y, mod);
-        if (!yd.carry)
-            yn = yd.value;
+    static constexpr uint<N> mul(
+        const montgomery<N>& m, const uint<N>& x, const uint<N>& y) noexcept
+    {
+        return m.mul(x, y);
+    }
 
-        auto a = addc(xn, yn);
-        auto av = a.value;
-        auto b = subc(av, mod);
-        auto bv = b.value;
-        if (a.carry || !b.carry)
-            return bv;
-        return av;
+    static constexpr uint<N> mul(const barrett<N>& b, const uint<N>& x, const uint<N>& y) noexcept
+    {
+        return mulmod(x, y, b);
     }
 
-    auto s = addc(x, y);
-    uint<256 + 64> n = s.value;
-    n[4] = s.carry;
-    return udivrem(n, mod).rem;
-}
+    static constexpr uint<N> sqr(const montgomery<N>& m, const uint<N>& x) noexcept
+    {
+        return m.sqr(x);
+    }
 
-constexpr uint256 mulmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
-{
-    return udivrem(umul(x, y), mod).rem;
-}
+    static constexpr uint<N> sqr(const barrett<N>& b, const uint<N>& x) noexcept
+    {
+        return sqrmod(x, b);
+    }
+};
 
 #define INTX_JOIN(X, Y) X##Y
 /// Define type alias uintN = uint<N> and the matching literal ""_uN.
@@ -1702,6 +4060,9 @@ DEFINE_ALIAS_AND_LITERAL(320)
 DEFINE_ALIAS_AND_LITERAL(384)
 DEFINE_ALIAS_AND_LITERAL(448)
 DEFINE_ALIAS_AND_LITERAL(512)
+DEFINE_ALIAS_AND_LITERAL(1024)
+DEFINE_ALIAS_AND_LITERAL(2048)
+DEFINE_ALIAS_AND_LITERAL(4096)
 #undef DEFINE_ALIAS_AND_LITERAL
 #undef INTX_JOIN
 
@@ -1743,6 +4104,246 @@ constexpr T to_big_endian(const T& x) noexcept
     }
 }
 
+namespace internal
+{
+/// Reverses the bytes of the values of Size bytes with the Reverse function handling
+/// V-byte vectors: the bytes are reversed in the groups of min(Size, V) bytes.
+/// Returns the number of values processed.
+template <size_t Size, size_t V, typename Reverse>
+inline size_t reverse_bytes_vectors(
+    uint8_t* dst, const uint8_t* src, size_t n, Reverse reverse) noexcept
+{
+    static_assert(Size % V == 0 || V % Size == 0);
+    if constexpr (Size >= V)
+    {
+        // The vectors of a value are stored in the reverse order.
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t k = 0; k < Size; k += V)
+                reverse(&dst[i * Size + k], &src[i * Size + Size - V - k]);
+        }
+        return n;
+    }
+    else
+    {
+        constexpr auto values_per_vector = V / Size;
+        const auto m = n / values_per_vector * values_per_vector;
+        for (size_t k = 0; k < m * Size; k += V)
+            reverse(&dst[k], &src[k]);
+        return m;
+    }
+}
+
+/// Copies n values of Size bytes reversing the byte order of each value.
+/// This converts between big-endian bytes and the value representation on little-endian CPUs.
+/// The source and destination must not overlap.
+template <size_t Size>
+inline void reverse_bytes_n(uint8_t* dst, const uint8_t* src, size_t n) noexcept
+{
+    static_assert(Size % 8 == 0);
+    size_t i = 0;
+
+#if defined(__AVX512VBMI__)
+    if constexpr (Size % 16 == 0 && (Size <= 32 || Size % 64 == 0))
+    {
+        static constexpr auto index = [] {
+            constexpr auto g = std::min(Size, size_t{64});
+            std::array<uint8_t, 64> a{};
+            for (size_t j = 0; j < a.size(); ++j)
+                a[j] = static_cast<uint8_t>(j / g * g + g - 1 - j % g);
+            return a;
+        }();
+        const auto rev = _mm512_loadu_si512(index.data());
+        i = reverse_bytes_vectors<Size, 64>(dst, src, n, [rev](uint8_t* out, const uint8_t* in) {
+            // The full-mask variant avoids the GCC -Wmaybe-uninitialized false positive.
+            const auto x = _mm512_loadu_si512(in);
+            _mm512_storeu_si512(out, _mm512_maskz_permutexvar_epi8(~__mmask64{0}, rev, x));
+        });
+    }
+#elif defined(__AVX2__)
+    if constexpr (Size == 16 || Size % 32 == 0)
+    {
+        const auto rev = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+            15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        i = reverse_bytes_vectors<Size, 32>(dst, src, n, [rev](uint8_t* out, const uint8_t* in) {
+            // The shuffle reverses the bytes in the 128-bit lanes and the permutation swaps them.
+            const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+            auto v = _mm256_shuffle_epi8(x, rev);
+            if constexpr (Size != 16)
+                v = _mm256_permute4x64_epi64(v, 0b01'00'11'10);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+        });
+    }
+#elif INTX_HAS_SSE2
+    if constexpr (Size % 16 == 0)
+    {
+        i = reverse_bytes_vectors<Size, 16>(dst, src, n, [](uint8_t* out, const uint8_t* in) {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    #ifdef __SSSE3__
+            v = _mm_shuffle_epi8(
+                v, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+    #else
+            // Reverse the order of the 16-bit words and then swap the bytes in them.
+            v = _mm_shuffle_epi32(v, 0b01'00'11'10);
+            v = _mm_shufflelo_epi16(v, 0b00'01'10'11);
+            v = _mm_shufflehi_epi16(v, 0b00'01'10'11);
+            v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    #endif
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+        });
+    }
+#endif
+
+    // Reverse the order of the byte-swapped words.
+    constexpr auto num_words = Size / 8;
+    for (; i < n; ++i)
+    {
+        uint64_t w[num_words];
+        std::memcpy(w, &src[i * Size], Size);
+        uint64_t r[num_words];
+        for (size_t k = 0; k < num_words; ++k)
+            r[k] = bswap(w[num_words - 1 - k]);
+        std::memcpy(&dst[i * Size], r, Size);
+    }
+}
+
+/// Returns the 64 bits of the value starting at the bit position (the bits above the value
+/// are zeros).
+template <unsigned N>
+constexpr uint64_t extract_bits64(const uint<N>& x, unsigned pos) noexcept
+{
+    INTX_REQUIRE(pos < N);
+    const auto i = pos / 64;
+    const auto r = pos % 64;
+    const auto hi = i + 1 < uint<N>::num_words ? x[i + 1] : 0;
+    return (x[i] >> r) | ((hi << 1) << (63 - r));
+}
+
+/// Stores the word in big-endian order.
+template <typename T>
+inline void store_be_word(uint8_t* dst, const T& x) noexcept
+{
+    const auto d = to_big_endian(x);
+    std::memcpy(dst, &d, sizeof(d));
+}
+
+/// Loads the word from bytes of big-endian order.
+template <typename T>
+inline T load_be_word(const uint8_t* src) noexcept
+{
+    T x;
+    std::memcpy(&x, src, sizeof(x));
+    return to_big_endian(x);
+}
+
+/// Stores the n = count_significant_bytes(x) bytes of the minimal big-endian form of x.
+/// The bytes are assembled in registers: with AVX-512 VBMI by a byte permutation and a masked
+/// store (branchless), otherwise by overlapping big-endian word stores of the size class of n.
+template <unsigned N>
+[[gnu::always_inline]] inline void store_minimal_small(
+    uint8_t* dst, const uint<N>& x, unsigned n) noexcept
+{
+    static_assert(N <= 256);
+#if defined(__AVX512VBMI__) && defined(__AVX512VL__)
+    const auto word = [&x](size_t i) noexcept {
+        return static_cast<long long>(i < uint<N>::num_words ? x[i] : 0);
+    };
+    const auto v = _mm256_set_epi64x(word(3), word(2), word(1), word(0));
+    // The j-th output byte is the byte n-1-j of the value.
+    const auto index = _mm256_sub_epi8(_mm256_set1_epi8(static_cast<char>(n - 1)),
+        _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+            20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31));
+    const auto mask = static_cast<__mmask32>((uint64_t{1} << n) - 1);
+    _mm256_mask_storeu_epi8(dst, mask, _mm256_maskz_permutexvar_epi8(mask, index, v));
+#else
+    if (n >= 16)
+    {
+        store_be_word(dst, extract_bits64(x, 8 * n - 64));
+        store_be_word(dst + 8, extract_bits64(x, 8 * n - 128));
+        store_be_word(dst + n - 16, x[1]);
+        store_be_word(dst + n - 8, x[0]);
+    }
+    else if (n >= 8)
+    {
+        store_be_word(dst, extract_bits64(x, 8 * n - 64));
+        store_be_word(dst + n - 8, x[0]);
+    }
+    else if (n >= 4)
+    {
+        store_be_word(dst, static_cast<uint32_t>(x[0] >> (8 * (n - 4))));
+        store_be_word(dst + n - 4, static_cast<uint32_t>(x[0]));
+    }
+    else if (n != 0)
+    {
+        // Store 1-3 bytes, possibly the same byte multiple times.
+        dst[0] = static_cast<uint8_t>(x[0] >> (8 * (n - 1)));
+        dst[n / 2] = static_cast<uint8_t>(x[0] >> (8 * (n - 1 - n / 2)));
+        dst[n - 1] = static_cast<uint8_t>(x[0]);
+    }
+#endif
+}
+
+/// Loads the value from n bytes of big-endian order, the reverse of store_minimal_small().
+template <unsigned N>
+[[gnu::always_inline]] inline uint<N> load_minimal_small(const uint8_t* src, unsigned n) noexcept
+{
+    static_assert(N <= 256);
+#if defined(__AVX512VBMI__) && defined(__AVX512VL__)
+    const auto index = _mm256_sub_epi8(_mm256_set1_epi8(static_cast<char>(n - 1)),
+        _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+            20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31));
+    const auto mask = static_cast<__mmask32>((uint64_t{1} << n) - 1);
+    const auto v = _mm256_maskz_permutexvar_epi8(mask, index, _mm256_maskz_loadu_epi8(mask, src));
+    alignas(32) uint64_t words[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(words), v);
+    return uint<N>{std::span{words, uint<N>::num_words}};
+#else
+    // The words are loaded from the end and the highest bytes are shifted into place.
+    uint64_t w[4]{};
+    if (n >= 16)
+    {
+        const auto hi = load_be_word<uint128>(src) >> (8 * (32 - n));
+        w[0] = load_be_word<uint64_t>(src + n - 8);
+        w[1] = load_be_word<uint64_t>(src + n - 16);
+        w[2] = hi[0];
+        w[3] = hi[1];
+    }
+    else if (n >= 8)
+    {
+        w[0] = load_be_word<uint64_t>(src + n - 8);
+        w[1] = (load_be_word<uint64_t>(src) >> 1) >> (8 * (16 - n) - 1);
+    }
+    else if (n >= 4)
+    {
+        w[0] = (uint64_t{load_be_word<uint32_t>(src)} << (8 * (n - 4))) |
+               load_be_word<uint32_t>(src + n - 4);
+    }
+    else if (n != 0)
+    {
+        // Load 1-3 bytes, possibly the same byte multiple times.
+        w[0] = (uint64_t{src[0]} << (8 * (n - 1))) |
+               (uint64_t{src[n / 2]} << (8 * (n - 1 - n / 2))) | src[n - 1];
+    }
+
+    uint<N> x;
+    size_t i = 0;
+    #if INTX_HAS_SSE2
+    // Write the words in pairs: the value is likely copied with 16-byte moves next
+    // and these cannot be forwarded from 8-byte stores.
+    for (; i + 2 <= uint<N>::num_words; i += 2)
+    {
+        const auto v = _mm_set_epi64x(
+            static_cast<long long>(w[i + 1]), static_cast<long long>(w[i]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&x[i]), v);
+    }
+    #endif
+    for (; i < uint<N>::num_words; ++i)
+        x[i] = w[i];
+    return x;
+#endif
+}
+}  // namespace internal
+
 namespace le  // Conversions to/from LE bytes.
 {
 template <typename T, unsigned M>
@@ -1779,6 +4380,43 @@ inline void store(uint8_t* dst, const T& x) noexcept
     std::memcpy(dst, &d, sizeof(d));
 }
 }  // namespace unsafe
+
+/// Loads the consecutive values from bytes of little-endian order.
+/// The size of the source bytes must match the size of the destination values.
+template <unsigned N>
+inline void load_n(std::span<const uint8_t> src, std::span<uint<N>> dst) noexcept
+{
+    INTX_REQUIRE(src.size() == dst.size_bytes());
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        // The data() of the empty spans may be null, which is not allowed in memcpy().
+        if (!src.empty())
+            std::memcpy(dst.data(), src.data(), src.size());
+    }
+    else
+    {
+        for (size_t i = 0; i < dst.size(); ++i)
+            dst[i] = unsafe::load<uint<N>>(&src[i * sizeof(uint<N>)]);
+    }
+}
+
+/// Stores the values in consecutive bytes in little-endian order.
+/// The size of the destination bytes must match the size of the source values.
+template <unsigned N>
+inline void store_n(std::span<uint8_t> dst, std::span<const uint<N>> src) noexcept
+{
+    INTX_REQUIRE(dst.size() == src.size_bytes());
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        if (!dst.empty())  // See load_n().
+            std::memcpy(dst.data(), src.data(), dst.size());
+    }
+    else
+    {
+        for (size_t i = 0; i < src.size(); ++i)
+            unsafe::store(&dst[i * sizeof(uint<N>)], src[i]);
+    }
+}
 }  // namespace le
 
 
@@ -1879,6 +4517,41 @@ inline T trunc(const uint<N>& x) noexcept
     return r;
 }
 
+/// Stores the minimal big-endian representation of the value (without leading zero bytes),
+/// as used by RLP. The zero value has the empty representation.
+/// The destination must have space for at least count_significant_bytes(x) bytes
+/// and only this many bytes are written. Returns the number of bytes written.
+template <unsigned N>
+inline size_t store_minimal(uint8_t* dst, const uint<N>& x) noexcept
+{
+    const auto size = count_significant_bytes(x);
+    if constexpr (N <= 256 && std::endian::native == std::endian::little)
+        internal::store_minimal_small(dst, x, size);
+    else
+    {
+        const auto d = to_big_endian(x);
+        std::memcpy(dst, &as_bytes(d)[sizeof(d) - size], size);
+    }
+    return size;
+}
+
+/// Loads the value from its minimal big-endian representation.
+/// Returns nullopt for the non-minimal input: longer than the value or with a leading zero byte.
+template <typename T>
+inline std::optional<T> load_minimal(std::span<const uint8_t> src) noexcept
+{
+    const auto size = src.size();
+    if (size == 0)
+        return T{};
+    if (size > sizeof(T) || src[0] == 0)
+        return std::nullopt;
+
+    if constexpr (T::num_bits <= 256 && std::endian::native == std::endian::little)
+        return internal::load_minimal_small<T::num_bits>(src.data(), static_cast<unsigned>(size));
+    else
+        return load<T>(src);
+}
+
 namespace unsafe
 {
 /// Loads an uint value from a buffer. The user must make sure
@@ -1924,10 +4597,279 @@ inline void store(uint8_t* dst, const uint256& x) noexcept
 
 }  // namespace unsafe
 
+/// Loads the consecutive values from bytes of big-endian order, e.g. the ABI-encoded words.
+/// The size of the source bytes must match the size of the destination values
+/// and the ranges must not overlap.
+template <unsigned N>
+inline void load_n(std::span<const uint8_t> src, std::span<uint<N>> dst) noexcept
+{
+    INTX_REQUIRE(src.size() == dst.size_bytes());
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        internal::reverse_bytes_n<sizeof(uint<N>)>(
+            reinterpret_cast<uint8_t*>(dst.data()), src.data(), dst.size());
+    }
+    else
+    {
+        for (size_t i = 0; i < dst.size(); ++i)
+            dst[i] = unsafe::load<uint<N>>(&src[i * sizeof(uint<N>)]);
+    }
+}
+
+/// Stores the values in consecutive bytes in big-endian order.
+/// The size of the destination bytes must match the size of the source values
+/// and the ranges must not overlap.
+template <unsigned N>
+inline void store_n(std::span<uint8_t> dst, std::span<const uint<N>> src) noexcept
+{
+    INTX_REQUIRE(dst.size() == src.size_bytes());
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        internal::reverse_bytes_n<sizeof(uint<N>)>(
+            dst.data(), reinterpret_cast<const uint8_t*>(src.data()), src.size());
+    }
+    else
+    {
+        for (size_t i = 0; i < src.size(); ++i)
+            unsafe::store(&dst[i * sizeof(uint<N>)], src[i]);
+    }
+}
+
 }  // namespace be
 
+namespace internal
+{
+/// Spreads the low 56 bits to the low 7 bits of the 8 bytes (PDEP with the 0x7f byte mask).
+inline uint64_t deposit_7bit_groups(uint64_t x) noexcept
+{
+#ifdef __BMI2__
+    return _pdep_u64(x, 0x7f7f7f7f7f7f7f7f);
+#else
+    uint64_t r = 0;
+    for (unsigned i = 0; i < 8; ++i)
+        r |= (x << i) & (uint64_t{0x7f} << (8 * i));
+    return r;
+#endif
+}
+
+/// Gathers the low 7 bits of the 8 bytes to the low 56 bits (PEXT with the 0x7f byte mask).
+inline uint64_t extract_7bit_groups(uint64_t x) noexcept
+{
+#ifdef __BMI2__
+    return _pext_u64(x, 0x7f7f7f7f7f7f7f7f);
+#else
+    uint64_t r = 0;
+    for (unsigned i = 0; i < 8; ++i)
+        r |= (x >> i) & (uint64_t{0x7f} << (7 * i));
+    return r;
+#endif
+}
+
+/// Stores the n (1-8) low bytes of the word in little-endian order
+/// with at most two overlapping stores.
+inline void store_le_bytes(uint8_t* dst, uint64_t x, unsigned n) noexcept
+{
+    const auto store = [](uint8_t* p, auto v) noexcept {
+        v = to_little_endian(v);
+        std::memcpy(p, &v, sizeof(v));
+    };
+    if (n == 8)
+        store(dst, x);
+    else if (n >= 4)
+    {
+        store(dst, static_cast<uint32_t>(x));
+        store(dst + n - 4, static_cast<uint32_t>(x >> (8 * (n - 4))));
+    }
+    else if (n >= 2)
+    {
+        store(dst, static_cast<uint16_t>(x));
+        store(dst + n - 2, static_cast<uint16_t>(x >> (8 * (n - 2))));
+    }
+    else
+        dst[0] = static_cast<uint8_t>(x);
+}
+}  // namespace internal
+
+/// LEB128 variable-length encoding: 7 bits per byte starting from the least significant ones,
+/// the highest bit of a byte is set if more bytes follow.
+/// The encoding and decoding process 8 bytes (56 bits) at a time using PDEP/PEXT with BMI2.
+namespace varint
+{
+/// The maximum size of the encoding of a uint<N> value.
+template <unsigned N>
+inline constexpr size_t max_size = (N + 6) / 7;
+
+/// Encodes the value and returns the number of bytes written, at most max_size<N>.
+template <unsigned N>
+inline size_t encode(const uint<N>& x, uint8_t* out) noexcept
+{
+    constexpr uint64_t continuation_bits = 0x8080808080808080;
+
+    const auto w = count_significant_words(x);
+    const auto num_bits = w != 0 ? 64 * w - clz(x[w - 1]) : 1;
+    const auto size = (num_bits + 6) / 7;
+
+    // The leading 56-bit chunks have all continuation bits set.
+    unsigned pos = 0;
+    for (; size - pos > 8; pos += 8)
+    {
+        const auto chunk = internal::extract_bits64(x, 7 * pos) & 0x00ffffffffffffff;
+        const auto bytes = internal::deposit_7bit_groups(chunk) | continuation_bits;
+        internal::store_le_bytes(&out[pos], bytes, 8);
+    }
+
+    const auto n = size - pos;
+    const auto chunk = internal::extract_bits64(x, 7 * pos) & ((uint64_t{1} << (7 * n)) - 1);
+    const auto last_continuation_bits = continuation_bits & ((uint64_t{1} << (8 * (n - 1))) - 1);
+    const auto bytes = internal::deposit_7bit_groups(chunk) | last_continuation_bits;
+    internal::store_le_bytes(&out[pos], bytes, n);
+    return size;
+}
+
+/// Decodes the value. Returns the number of bytes consumed, or 0 if the input is truncated,
+/// longer than max_size<N> or the value does not fit in N bits.
+template <unsigned N>
+inline size_t decode(std::span<const uint8_t> in, uint<N>& value) noexcept
+{
+    constexpr uint64_t continuation_bits = 0x8080808080808080;
+
+    // Adds the chunk at the bit position, checking the overflow.
+    uint<N> r;
+    const auto add = [&r](uint64_t chunk, size_t pos) noexcept {
+        const auto w = pos / 64;
+        const auto shift = pos % 64;
+        if (w >= uint<N>::num_words)
+            return chunk == 0;
+        r[w] |= chunk << shift;
+        const auto hi = shift != 0 ? chunk >> (64 - shift) : 0;
+        if (w + 1 == uint<N>::num_words)
+            return hi == 0;
+        r[w + 1] |= hi;
+        return true;
+    };
+
+    size_t i = 0;
+    for (; in.size() - i >= 8 && i < max_size<N>; i += 8)
+    {
+        uint64_t bytes;
+        std::memcpy(&bytes, &in[i], sizeof(bytes));
+        bytes = to_little_endian(bytes);
+
+        const auto last = ~bytes & continuation_bits;
+        if (last != 0)
+        {
+            const auto n = static_cast<unsigned>(std::countr_zero(last)) / 8 + 1;
+            const auto mask = ~uint64_t{0} >> (64 - 8 * n);
+            const auto size = i + n;
+            if (size > max_size<N> || !add(internal::extract_7bit_groups(bytes & mask), 7 * i))
+                return 0;
+            value = r;
+            return size;
+        }
+        if (!add(internal::extract_7bit_groups(bytes), 7 * i))
+            return 0;
+    }
+
+    // The tail shorter than 8 bytes.
+    for (; i < in.size() && i < max_size<N>; ++i)
+    {
+        if (!add(in[i] & 0x7fu, 7 * i))
+            return 0;
+        if ((in[i] & 0x80) == 0)
+        {
+            value = r;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+}  // namespace varint
+
+namespace internal
+{
+/// Multiplies the values and folds the high half of the product into the low half.
+constexpr uint64_t fold_mul(uint64_t x, uint64_t y) noexcept
+{
+    const auto p = umul(x, y);
+    return p[0] ^ p[1];
+}
+
+/// The constants for the hash functions: odd, with balanced bits.
+inline constexpr uint64_t hash_secrets[] = {
+    0xa0761d6478bd642f, 0xe7037ed1a0b428db, 0x8ebc6af09c88c6e3, 0x589965cc75374cc3};
+}  // namespace internal
+
+/// Computes the 128-bit hash of the value. Not cryptographic.
+///
+/// Each pair of words is multiplied, after mixing in the word-position secrets, into the full
+/// 128-bit product. The pair itself is also added to the product: otherwise a word equal to
+/// its secret would zero the product and the other word would not affect the hash.
+/// The pair values are summed independently so the multiplications run in parallel,
+/// and the two halves of the sum are finally mixed with each other. Both halves of the result are
+/// usable as independent hashes, e.g. the bucket index and the fingerprint in open addressing.
+template <unsigned N>
+constexpr uint128 hash128(const uint<N>& x, uint64_t seed = 0) noexcept
+{
+    using internal::hash_secrets;
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint128 acc{seed ^ hash_secrets[0], N};
+    for (size_t i = 0; i < num_words; i += 2)
+    {
+        const auto s = seed + hash_secrets[1] * (i + 1);
+        const auto lo = x[i] ^ s;
+        const auto hi = (i + 1 < num_words ? x[i + 1] : 0) ^ std::rotl(s, 32) ^ hash_secrets[2];
+        acc += umul(lo, hi) + uint128{lo, hi};
+    }
+    return {internal::fold_mul(acc[0] ^ hash_secrets[1], acc[1] ^ hash_secrets[3]),
+        internal::fold_mul(acc[0] ^ hash_secrets[2], acc[1] ^ hash_secrets[0])};
+}
+
+/// Computes the 64-bit hash of the value. Not cryptographic.
+/// This is the low half of hash128().
+template <unsigned N>
+constexpr uint64_t hash64(const uint<N>& x, uint64_t seed = 0) noexcept
+{
+    return hash128(x, seed)[0];
+}
 }  // namespace intx
 
+/// The std::hash support, e.g. for std::unordered_map keys, see intx::hash64().
+template <unsigned N>
+struct std::hash<intx::uint<N>>  // NOLINT(cert-dcl58-cpp)
+{
+    constexpr size_t operator()(const intx::uint<N>& x) const noexcept
+    {
+        return static_cast<size_t>(intx::hash64(x));
+    }
+};
+
+#ifdef __cpp_lib_format
+/// The std::format() support with the standard integer format specification, see
+/// intx::internal::format_spec.
+template <unsigned N>
+struct std::formatter<intx::uint<N>>  // NOLINT(cert-dcl58-cpp)
+{
+    intx::internal::format_spec spec;
+
+    constexpr auto parse(std::format_parse_context& ctx)
+    {
+        const auto first = std::to_address(ctx.begin());
+        const auto last = first + (ctx.end() - ctx.begin());
+        const auto p = spec.parse(first, last);
+        if (p == nullptr)
+            throw std::format_error{"invalid format spec for intx::uint"};
+        return ctx.begin() + (p - first);
+    }
+
+    template <typename FormatContext>
+    auto format(const intx::uint<N>& x, FormatContext& ctx) const
+    {
+        return intx::internal::format_to(ctx.out(), x, spec);
+    }
+};
+#endif
+
 #ifdef _MSC_VER
     #pragma warning(pop)
 #endif
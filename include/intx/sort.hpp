@@ -0,0 +1,286 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The radix sort of big integers.
+///
+/// The MSD radix sort with 8-bit digits taken from the 64-bit words of the keys. The keys are
+/// scattered by the most significant digit to the scratch buffer and the buckets are sorted
+/// recursively, swapping the roles of the buffers; the small buckets are finished with
+/// the comparison sort. The digits having the same value in all the keys (e.g. the bytes of
+/// the zero high words) are detected upfront and skipped without any pass over the keys.
+/// The parallel mode partitions by the first digit with all the threads and then distributes
+/// the buckets between the threads. This uses std::thread so the Threads library must be linked.
+
+#pragma once
+
+#include <intx/intx.hpp>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace intx
+{
+namespace internal
+{
+/// The number of the buckets of the 8-bit digit.
+inline constexpr size_t radix_size = 256;
+
+/// The number of keys below which the comparison sort is used instead.
+inline constexpr size_t radix_sort_threshold = 64;
+
+/// The minimal number of keys per thread in the parallel mode.
+inline constexpr size_t radix_sort_min_chunk = 1 << 16;
+
+using radix_histogram = std::array<size_t, radix_size>;
+
+/// The tag type of the radix sort without the values.
+struct no_values
+{};
+
+/// Returns the pointer to the value at the index i, or the null pointer without the values.
+template <typename T>
+inline T* radix_at(T* values, size_t i) noexcept
+{
+    if constexpr (std::is_same_v<T, no_values>)
+        return values;
+    else
+        return values + i;
+}
+
+/// Returns the digit of the key: the byte at the index d of the little-endian representation.
+template <unsigned N>
+inline size_t radix_digit(const uint<N>& x, size_t d) noexcept
+{
+    return static_cast<uint8_t>(x[d / 8] >> (d % 8 * 8));
+}
+
+/// Returns the indexes of the digits which are not equal in all the keys,
+/// from the most significant one.
+template <unsigned N>
+inline std::vector<size_t> radix_active_digits(std::span<const uint<N>> keys)
+{
+    uint<N> diff;
+    for (const auto& k : keys)
+        diff |= k ^ keys[0];
+
+    std::vector<size_t> active;
+    for (size_t d = sizeof(diff); d-- != 0;)
+    {
+        if (radix_digit(diff, d) != 0)
+            active.push_back(d);
+    }
+    return active;
+}
+
+/// Counts the digits d of the keys in [begin, end) into the histogram.
+template <unsigned N>
+inline void radix_count(
+    radix_histogram& hist, const uint<N>* keys, size_t begin, size_t end, size_t d) noexcept
+{
+    hist = {};
+    for (size_t i = begin; i < end; ++i)
+        ++hist[radix_digit(keys[i], d)];
+}
+
+/// Converts the counts to the offsets of the buckets.
+inline void radix_offsets(radix_histogram& hist, size_t first = 0) noexcept
+{
+    for (auto& c : hist)
+        first += std::exchange(c, first);
+}
+
+/// Moves the keys and the values in [begin, end) to the positions given by the offsets
+/// of their digits d, advancing the offsets. The relative order is preserved.
+template <unsigned N, typename T>
+inline void radix_scatter(radix_histogram& offsets, const uint<N>* src_keys, uint<N>* dst_keys,
+    T* src_values, T* dst_values, size_t begin, size_t end, size_t d) noexcept
+{
+    const auto w = d / 8;
+    const auto shift = d % 8 * 8;
+    for (size_t i = begin; i < end; ++i)
+    {
+        const auto pos = offsets[static_cast<uint8_t>(src_keys[i][w] >> shift)]++;
+        dst_keys[pos] = src_keys[i];
+        if constexpr (!std::is_same_v<T, no_values>)
+            dst_values[pos] = std::move(src_values[i]);
+    }
+}
+
+/// Copies the keys and the values from the src to the dst.
+template <unsigned N, typename T>
+inline void radix_copy(const uint<N>* src_keys, uint<N>* dst_keys, T* src_values,
+    T* dst_values, size_t n) noexcept
+{
+    std::copy_n(src_keys, n, dst_keys);
+    if constexpr (!std::is_same_v<T, no_values>)
+        std::move(src_values, src_values + n, dst_values);
+}
+
+/// Sorts the small number of keys with the comparison sort.
+/// With the values this is the insertion sort, so the sort remains stable.
+template <unsigned N, typename T>
+inline void radix_small_sort(uint<N>* keys, T* values, size_t n) noexcept
+{
+    if constexpr (std::is_same_v<T, no_values>)
+    {
+        std::sort(keys, keys + n);
+    }
+    else
+    {
+        for (size_t i = 1; i < n; ++i)
+        {
+            const auto key = keys[i];
+            auto value = std::move(values[i]);
+            auto j = i;
+            for (; j != 0 && key < keys[j - 1]; --j)
+            {
+                keys[j] = keys[j - 1];
+                values[j] = std::move(values[j - 1]);
+            }
+            keys[j] = key;
+            values[j] = std::move(value);
+        }
+    }
+}
+
+/// The MSD radix sort of the keys and the values in a, using b of the same size as the scratch
+/// space. The result is placed in b if result_in_b is set, in a otherwise.
+/// The active digits are the remaining digits to sort by, from the most significant one.
+template <unsigned N, typename T>
+inline void radix_sort(uint<N>* a_keys, uint<N>* b_keys, T* a_values, T* b_values, size_t n,
+    std::span<const size_t> active, bool result_in_b) noexcept
+{
+    if (n < radix_sort_threshold)
+    {
+        radix_small_sort(a_keys, a_values, n);
+        if (result_in_b)
+            radix_copy(a_keys, b_keys, a_values, b_values, n);
+        return;
+    }
+
+    // Skip the digits equal in all the keys.
+    radix_histogram hist;
+    for (; !active.empty(); active = active.subspan(1))
+    {
+        radix_count(hist, a_keys, 0, n, active[0]);
+        if (hist[radix_digit(a_keys[0], active[0])] != n)
+            break;
+    }
+    if (active.empty())  // All the keys are equal.
+    {
+        if (result_in_b)
+            radix_copy(a_keys, b_keys, a_values, b_values, n);
+        return;
+    }
+
+    radix_offsets(hist);
+    radix_scatter(hist, a_keys, b_keys, a_values, b_values, 0, n, active[0]);
+
+    // Sort the buckets now in b, with the roles of the buffers swapped.
+    // After the scatter the offsets point to the ends of the buckets.
+    size_t begin = 0;
+    for (const auto end : hist)
+    {
+        radix_sort(b_keys + begin, a_keys + begin, radix_at(b_values, begin),
+            radix_at(a_values, begin), end - begin, active.subspan(1), !result_in_b);
+        begin = end;
+    }
+}
+
+/// Runs fn(t) for t in [0, num_threads), each in a separate thread except the first one.
+template <typename Fn>
+inline void radix_parallel_run(unsigned num_threads, const Fn& fn)
+{
+    std::vector<std::jthread> threads;
+    threads.reserve(num_threads - 1);
+    for (unsigned t = 1; t < num_threads; ++t)
+        threads.emplace_back(fn, t);
+    fn(0u);
+}
+
+template <unsigned N, typename T>
+inline void radix_sort(std::span<uint<N>> keys, T* values, unsigned num_threads)
+{
+    const auto n = keys.size();
+    if (n < radix_sort_threshold)
+        return radix_small_sort(keys.data(), values, n);
+
+    const auto active = radix_active_digits<N>(keys);
+    if (active.empty())
+        return;
+
+    std::vector<uint<N>> tmp_keys(n);
+    std::vector<T> tmp_values(std::is_same_v<T, no_values> ? 0 : n);
+
+    const auto threads = static_cast<unsigned>(
+        std::max<size_t>(std::min<size_t>(n / radix_sort_min_chunk, num_threads), 1));
+    if (threads == 1)
+        return radix_sort(keys.data(), tmp_keys.data(), values, tmp_values.data(), n,
+            std::span{active}, false);
+
+    // Partition by the most significant active digit in parallel: each thread counts
+    // and then scatters its chunk to the part of each bucket after the previous threads.
+    const auto chunk = (n + threads - 1) / threads;
+    const auto d = active[0];
+    std::vector<radix_histogram> hists(threads);
+    radix_parallel_run(threads, [&](unsigned t) noexcept {
+        radix_count(
+            hists[t], keys.data(), std::min(t * chunk, n), std::min((t + 1) * chunk, n), d);
+    });
+
+    radix_histogram counts{};
+    size_t sum = 0;
+    for (size_t b = 0; b < radix_size; ++b)
+    {
+        for (auto& hist : hists)
+        {
+            counts[b] += hist[b];
+            sum += std::exchange(hist[b], sum);
+        }
+    }
+
+    radix_parallel_run(threads, [&](unsigned t) noexcept {
+        radix_scatter(hists[t], keys.data(), tmp_keys.data(), values, tmp_values.data(),
+            std::min(t * chunk, n), std::min((t + 1) * chunk, n), d);
+    });
+
+    // Sort the buckets in parallel, each thread takes the next unsorted bucket.
+    radix_histogram offsets = counts;
+    radix_offsets(offsets);
+    std::atomic<size_t> next_bucket = 0;
+    radix_parallel_run(threads, [&](unsigned) noexcept {
+        for (size_t b; (b = next_bucket++) < radix_size;)
+        {
+            const auto offset = offsets[b];
+            radix_sort(tmp_keys.data() + offset, keys.data() + offset,
+                radix_at(tmp_values.data(), offset), radix_at(values, offset), counts[b],
+                std::span{active}.subspan(1), true);
+        }
+    });
+}
+}  // namespace internal
+
+/// Sorts the keys in ascending order.
+///
+/// The num_threads > 1 enables the parallel mode for large inputs: at most num_threads threads
+/// are used, each taking at least internal::radix_sort_min_chunk keys.
+template <unsigned N>
+inline void radix_sort(std::span<uint<N>> keys, unsigned num_threads = 1)
+{
+    internal::radix_sort(keys, static_cast<internal::no_values*>(nullptr), num_threads);
+}
+
+/// Sorts the keys in ascending order and permutes the values in the same way.
+/// The sort is stable: the values with equal keys keep their relative order.
+/// The sizes of the keys and the values must be equal.
+template <unsigned N, typename T>
+inline void radix_sort(std::span<uint<N>> keys, std::span<T> values, unsigned num_threads = 1)
+{
+    static_assert(std::is_nothrow_move_assignable_v<T> && std::is_default_constructible_v<T>);
+    INTX_REQUIRE(keys.size() == values.size());
+    internal::radix_sort(keys, values.data(), num_threads);
+}
+}  // namespace intx
@@ -0,0 +1,268 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The static search index of big integers.
+///
+/// The sorted_index<N> keeps the sorted keys and the implicit B-tree (S-tree) of their search
+/// words: the most significant words in which the keys differ. Each tree node is a cache line
+/// of 8 words, searched with a single SIMD compare, and has 9 children located at the fixed
+/// positions, so the search does not need any pointers. The full keys are only compared when
+/// the search words of the key and the query are equal.
+
+#pragma once
+
+#include <intx/sort.hpp>
+
+#if INTX_HAS_X86_64_ASM && (defined(__AVX512F__) || defined(__AVX2__))
+    #include <immintrin.h>
+#endif
+
+namespace intx
+{
+namespace internal
+{
+/// The number of the search words in the node of the sorted_index: one cache line.
+inline constexpr size_t search_node_size = 8;
+
+/// The node of the sorted_index search tree.
+struct alignas(64) search_node
+{
+    uint64_t words[search_node_size];
+};
+
+/// Hints the CPU to load the cache line of the address.
+inline void prefetch([[maybe_unused]] const void* p) noexcept
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(p);
+#endif
+}
+
+/// Returns the number of the node words less than x. The node words must be sorted.
+inline unsigned count_less(const search_node& node, uint64_t x) noexcept
+{
+#if INTX_HAS_X86_64_ASM && defined(__AVX512F__)
+    const auto v = _mm512_load_si512(node.words);
+    return static_cast<unsigned>(
+        std::popcount(_mm512_cmplt_epu64_mask(v, _mm512_set1_epi64(static_cast<int64_t>(x)))));
+#elif INTX_HAS_X86_64_ASM && defined(__AVX2__)
+    // The unsigned comparison is the signed one with the sign bits flipped.
+    const auto sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+    const auto xs = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(x)), sign);
+    const auto lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(&node.words[0]));
+    const auto hi = _mm256_load_si256(reinterpret_cast<const __m256i*>(&node.words[4]));
+    const auto lo_lt = _mm256_cmpgt_epi64(xs, _mm256_xor_si256(lo, sign));
+    const auto hi_lt = _mm256_cmpgt_epi64(xs, _mm256_xor_si256(hi, sign));
+    const auto mask = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(lo_lt))) |
+                      static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(hi_lt))) << 4;
+    return static_cast<unsigned>(std::popcount(mask));
+#else
+    unsigned count = 0;
+    for (const auto w : node.words)
+        count += w < x;
+    return count;
+#endif
+}
+}  // namespace internal
+
+/// The read-only index of the set of keys for the fast lower bound and membership lookups.
+template <unsigned N>
+class sorted_index
+{
+    static constexpr auto node_size = internal::search_node_size;
+
+    /// The keys in ascending order.
+    std::vector<uint<N>> keys_;
+
+    /// The index of the search word: the most significant word not equal in all the keys.
+    size_t word_ = 0;
+
+    /// The search tree of the search words of the keys.
+    /// The children of the node k are the nodes child(k, i) for i in [0, node_size].
+    std::vector<internal::search_node> tree_;
+
+    /// The positions in keys_ of the tree node words, n for the padding.
+    std::vector<size_t> ranks_;
+
+    static constexpr size_t child(size_t k, size_t i) noexcept
+    {
+        return k * (node_size + 1) + 1 + i;
+    }
+
+    /// Fills the subtree of the node k with the keys starting from keys_[t], in-order.
+    void build(size_t k, size_t& t) noexcept
+    {
+        if (k >= tree_.size())
+            return;
+
+        for (size_t i = 0; i < node_size; ++i)
+        {
+            build(child(k, i), t);
+            const auto has_key = t < keys_.size();
+            tree_[k].words[i] = has_key ? keys_[t][word_] : ~uint64_t{0};
+            ranks_[k * node_size + i] = has_key ? t++ : keys_.size();
+        }
+        build(child(k, node_size), t);
+    }
+
+    /// Compares the words above the search word with the keys' ones.
+    /// Returns the lower bound if it is decided by these words.
+    std::optional<size_t> check_prefix(const uint<N>& x) const noexcept
+    {
+        const auto& key = keys_[0];
+        for (size_t j = uint<N>::num_words - 1; j > word_; --j)
+        {
+            if (x[j] != key[j])
+                return x[j] < key[j] ? 0 : keys_.size();
+        }
+        return {};
+    }
+
+    /// Returns the lower bound of x given the position of the first key with the search word
+    /// not less than x's one. The full keys are compared only when the search words are equal.
+    size_t resolve(const uint<N>& x, size_t p) const noexcept
+    {
+        if (p == keys_.size() || keys_[p][word_] != x[word_] || !(keys_[p] < x))
+            return p;
+
+        // Galloping over the run of the equal search words.
+        size_t step = 1;
+        while (p + step < keys_.size() && keys_[p + step] < x)
+            step *= 2;
+        const auto last = std::min(p + step, keys_.size());
+        const auto first = keys_.begin() + static_cast<ptrdiff_t>(p + step / 2 + 1);
+        return static_cast<size_t>(
+            std::lower_bound(first, keys_.begin() + static_cast<ptrdiff_t>(last), x) -
+            keys_.begin());
+    }
+
+public:
+    /// Builds the index of the keys. The duplicates are kept.
+    explicit sorted_index(std::vector<uint<N>> keys) : keys_{std::move(keys)}
+    {
+        radix_sort(std::span{keys_});
+        if (keys_.empty())
+            return;
+
+        uint<N> diff;
+        for (const auto& k : keys_)
+            diff |= k ^ keys_[0];
+        const auto w = count_significant_words(diff);
+        word_ = w != 0 ? w - 1 : 0;
+
+        tree_.resize((keys_.size() + node_size - 1) / node_size);
+        ranks_.resize(tree_.size() * node_size);
+        size_t t = 0;
+        build(0, t);
+    }
+
+    /// Returns the number of the keys.
+    [[nodiscard]] size_t size() const noexcept { return keys_.size(); }
+
+    /// Returns the keys in ascending order.
+    [[nodiscard]] std::span<const uint<N>> keys() const noexcept { return keys_; }
+
+    /// Returns the position of the first key not less than x, or size() if there is none.
+    [[nodiscard]] size_t lower_bound(const uint<N>& x) const noexcept
+    {
+        if (keys_.empty())
+            return 0;
+        if (const auto p = check_prefix(x))
+            return *p;
+
+        const auto w = x[word_];
+        size_t slot = ranks_.size();
+        for (size_t k = 0; k < tree_.size();)
+        {
+            const auto i = internal::count_less(tree_[k], w);
+            if (i < node_size)
+                slot = k * node_size + i;
+            k = child(k, i);
+        }
+        return resolve(x, slot != ranks_.size() ? ranks_[slot] : keys_.size());
+    }
+
+    /// Computes the lower bounds of the multiple values, see lower_bound(const uint<N>&).
+    /// The searches are interleaved and the next nodes are prefetched, so the cache misses
+    /// of the independent searches overlap. The sizes of the xs and the out must be equal.
+    void lower_bound(std::span<const uint<N>> xs, std::span<size_t> out) const noexcept
+    {
+        INTX_REQUIRE(xs.size() == out.size());
+        constexpr size_t group_size = 16;
+        const auto done = tree_.size();
+
+        for (size_t g = 0; g < xs.size(); g += group_size)
+        {
+            const auto m = std::min(group_size, xs.size() - g);
+            const auto x = &xs[g];
+
+            size_t k[group_size];
+            size_t slots[group_size];
+            for (size_t q = 0; q < m; ++q)
+            {
+                slots[q] = ranks_.size();
+                k[q] = 0;
+                if (keys_.empty())
+                {
+                    out[g + q] = 0;
+                    k[q] = done;
+                }
+                else if (const auto p = check_prefix(x[q]))
+                {
+                    out[g + q] = *p;
+                    k[q] = done;
+                }
+            }
+
+            for (bool active = true; active;)
+            {
+                active = false;
+                for (size_t q = 0; q < m; ++q)
+                {
+                    if (k[q] >= done)
+                        continue;
+                    const auto i = internal::count_less(tree_[k[q]], x[q][word_]);
+                    if (i < node_size)
+                        slots[q] = k[q] * node_size + i;
+                    k[q] = child(k[q], i);
+                    if (k[q] < done)
+                    {
+                        internal::prefetch(&tree_[k[q]]);
+                        active = true;
+                    }
+                    else
+                    {
+                        k[q] = done + 1;  // Mark the finished search.
+                        if (slots[q] != ranks_.size())
+                            internal::prefetch(&ranks_[slots[q]]);
+                    }
+                }
+            }
+
+            // Load the positions and prefetch the keys for the final comparisons.
+            for (size_t q = 0; q < m; ++q)
+            {
+                if (k[q] == done)  // Decided by the prefix.
+                    continue;
+                slots[q] = slots[q] != ranks_.size() ? ranks_[slots[q]] : keys_.size();
+                if (slots[q] != keys_.size())
+                    internal::prefetch(&keys_[slots[q]]);
+            }
+            for (size_t q = 0; q < m; ++q)
+            {
+                if (k[q] != done)
+                    out[g + q] = resolve(x[q], slots[q]);
+            }
+        }
+    }
+
+    /// Checks if x is in the set.
+    [[nodiscard]] bool contains(const uint<N>& x) const noexcept
+    {
+        const auto p = lower_bound(x);
+        return p != keys_.size() && keys_[p] == x;
+    }
+};
+}  // namespace intx
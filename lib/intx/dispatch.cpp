@@ -0,0 +1,539 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <intx/dispatch.hpp>
+
+#if INTX_HAS_X86_64_ASM
+    #include <immintrin.h>
+#endif
+
+namespace intx
+{
+namespace internal
+{
+namespace
+{
+/// The baseline implementations of the dispatched kernels.
+namespace portable
+{
+uint512 umul(const uint256& x, const uint256& y) noexcept
+{
+    return umul_portable(x, y);
+}
+
+div_result<uint256> udivrem(const uint256& x, const uint256& y) noexcept
+{
+    return intx::udivrem(x, y);
+}
+
+uint256 mulmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    return intx::mulmod(x, y, mod);
+}
+
+uint256 addmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    return intx::addmod(x, y, mod);
+}
+
+void bswap(uint256* data, size_t size) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+        data[i] = intx::bswap(data[i]);
+}
+
+char* hex_encode(char* out, const uint8_t* data, size_t size) noexcept
+{
+    constexpr char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < size; ++i)
+    {
+        *out++ = digits[data[i] >> 4];
+        *out++ = digits[data[i] & 0xf];
+    }
+    return out;
+}
+
+/// Computes the modular products one by one. For an odd modulus and more than a few values
+/// the Montgomery multiplication is used, so the cost of the division is paid only in setup.
+void mulmod_batch(
+    const uint256* x, const uint256* y, size_t size, const uint256& mod, uint256* out) noexcept
+{
+    if ((mod[0] & 1) == 0 || size < 4)
+    {
+        for (size_t i = 0; i < size; ++i)
+            out[i] = intx::mulmod(x[i], y[i], mod);
+        return;
+    }
+
+    // The Montgomery product x·y·R^-1 converted to the Montgomery form is x·y mod m.
+    const montgomery<256> mont{mod};
+    for (size_t i = 0; i < size; ++i)
+    {
+        const auto a = x[i] < mod ? x[i] : x[i] % mod;
+        const auto b = y[i] < mod ? y[i] : y[i] % mod;
+        out[i] = mont.to_mont(mont.mul(a, b));
+    }
+}
+}  // namespace portable
+
+#if INTX_HAS_X86_64_ASM
+/// The arithmetic kernels for CPUs with BMI2 and ADX.
+///
+/// The umul uses the MULX/ADX kernel directly. The other functions are compiled for the
+/// target features and flattened, so the inlined portable code uses MULX, SHLX/SHRX and LZCNT.
+namespace bmi2_adx
+{
+    #define INTX_TARGET_BMI2_ADX gnu::target("bmi,bmi2,adx,lzcnt"), gnu::flatten
+
+[[INTX_TARGET_BMI2_ADX]] uint512 umul(const uint256& x, const uint256& y) noexcept
+{
+    uint512 p;
+    x86_64::umul_256(&p[0], &x[0], &y[0]);
+    return p;
+}
+
+[[INTX_TARGET_BMI2_ADX]] div_result<uint256> udivrem(
+    const uint256& x, const uint256& y) noexcept
+{
+    return intx::udivrem(x, y);
+}
+
+[[INTX_TARGET_BMI2_ADX]] uint256 mulmod(
+    const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    return intx::udivrem(umul(x, y), mod).rem;
+}
+
+[[INTX_TARGET_BMI2_ADX]] uint256 addmod(
+    const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    return intx::addmod(x, y, mod);
+}
+
+    #undef INTX_TARGET_BMI2_ADX
+}  // namespace bmi2_adx
+
+/// The byte processing kernels for CPUs with AVX2.
+namespace avx2
+{
+/// Reverses the bytes of each uint256: the shuffle reverses the bytes in the 128-bit lanes
+/// and the permutation swaps the lanes.
+[[gnu::target("avx2")]] void bswap(uint256* data, size_t size) noexcept
+{
+    const auto reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (size_t i = 0; i < size; ++i)
+    {
+        auto p = reinterpret_cast<__m256i*>(&data[i]);
+        const auto v = _mm256_shuffle_epi8(_mm256_loadu_si256(p), reverse);
+        _mm256_storeu_si256(p, _mm256_permute4x64_epi64(v, 0b01'00'11'10));
+    }
+}
+
+/// Encodes 16 bytes at a time. Each byte is zero-extended to 16 bits and the nibbles are
+/// placed in the bytes in the output order. Then the digits are looked up by the shuffle.
+[[gnu::target("avx2")]] char* hex_encode(
+    char* out, const uint8_t* data, size_t size) noexcept
+{
+    const auto digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b',
+        'c', 'd', 'e', 'f', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd',
+        'e', 'f');
+    const auto low_nibble_mask = _mm256_set1_epi16(0x0f);
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto b =
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[i])));
+        const auto hi = _mm256_srli_epi16(b, 4);
+        const auto lo = _mm256_slli_epi16(_mm256_and_si256(b, low_nibble_mask), 8);
+        const auto chars = _mm256_shuffle_epi8(digits, _mm256_or_si256(hi, lo));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), chars);
+        out += 32;
+    }
+    return portable::hex_encode(out, &data[i], size - i);
+}
+}  // namespace avx2
+
+/// The byte processing kernels for CPUs with AVX-512 F and BW.
+namespace avx512
+{
+/// Reverses the bytes of pairs of uint256 values as avx2::bswap(), but the permutation
+/// swaps the 128-bit lanes inside the 256-bit halves.
+[[gnu::target("avx512f,avx512bw")]] void bswap(uint256* data, size_t size) noexcept
+{
+    const auto reverse = _mm512_set_epi64(0x0001020304050607, 0x08090a0b0c0d0e0f,
+        0x0001020304050607, 0x08090a0b0c0d0e0f, 0x0001020304050607, 0x08090a0b0c0d0e0f,
+        0x0001020304050607, 0x08090a0b0c0d0e0f);
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2)
+    {
+        const auto p = &data[i];
+        const auto v = _mm512_shuffle_epi8(_mm512_loadu_si512(p), reverse);
+        // The full-mask variant avoids the GCC -Wuninitialized false positive.
+        _mm512_storeu_si512(p, _mm512_mask_permutex_epi64(v, 0xff, v, 0b01'00'11'10));
+    }
+    avx2::bswap(&data[i], size - i);
+}
+
+/// Encodes 32 bytes at a time as avx2::hex_encode().
+[[gnu::target("avx512f,avx512bw")]] char* hex_encode(
+    char* out, const uint8_t* data, size_t size) noexcept
+{
+    // The "0123456789abcdef" in every 128-bit lane.
+    const auto digits = _mm512_set4_epi64(
+        0x6665646362613938, 0x3736353433323130, 0x6665646362613938, 0x3736353433323130);
+    const auto low_nibble_mask = _mm512_set1_epi16(0x0f);
+
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const auto b =
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&data[i])));
+        const auto hi = _mm512_srli_epi16(b, 4);
+        const auto lo = _mm512_slli_epi16(_mm512_and_si512(b, low_nibble_mask), 8);
+        const auto chars = _mm512_shuffle_epi8(digits, _mm512_or_si512(hi, lo));
+        _mm512_storeu_si512(out, chars);
+        out += 64;
+    }
+    return avx2::hex_encode(out, &data[i], size - i);
+}
+}  // namespace avx512
+
+/// The batched kernels for CPUs with AVX-512 IFMA.
+///
+/// 8 values are processed in parallel, one in each 64-bit lane. The values are transposed
+/// to 5 vectors of 52-bit limbs (radix 2^52), so the 52-bit multiply-add instructions
+/// vpmadd52luq/vpmadd52huq compute the partial products. The spare 12 bits of the lanes
+/// accumulate the carries, so the limbs are normalized only at the end.
+namespace avx512_ifma
+{
+    #define INTX_TARGET_AVX512_IFMA gnu::target("avx512f,avx512ifma")
+
+/// The number of 52-bit limbs of a 256-bit value.
+constexpr size_t num_limbs = 5;
+
+constexpr uint64_t limb_mask = (uint64_t{1} << 52) - 1;
+
+// The masked variants of the gathers and the shifts avoid
+// the GCC -Wmaybe-uninitialized false positives.
+
+/// The 8 values in the radix 2^52 representation: limbs[j] contains the limb j of all values.
+using limbs = __m512i[num_limbs];
+
+/// Splits the words of a value into 52-bit limbs.
+constexpr std::array<uint64_t, num_limbs> to_limbs(const uint256& x) noexcept
+{
+    return {x[0] & limb_mask, ((x[0] >> 52) | (x[1] << 12)) & limb_mask,
+        ((x[1] >> 40) | (x[2] << 24)) & limb_mask, ((x[2] >> 28) | (x[3] << 36)) & limb_mask,
+        x[3] >> 16};
+}
+
+/// Shifts the lanes right.
+template <unsigned Shift>
+[[INTX_TARGET_AVX512_IFMA]] __m512i shr(__m512i x) noexcept
+{
+    return _mm512_maskz_srli_epi64(0xff, x, Shift);
+}
+
+/// Shifts the lanes left.
+template <unsigned Shift>
+[[INTX_TARGET_AVX512_IFMA]] __m512i shl(__m512i x) noexcept
+{
+    return _mm512_maskz_slli_epi64(0xff, x, Shift);
+}
+
+/// Loads 8 values and transposes them to limbs. The words are gathered with the stride
+/// of 4 words, i.e. the word i of all values is loaded to a single vector.
+[[INTX_TARGET_AVX512_IFMA]] void load(limbs& l, const uint256* values) noexcept
+{
+    const auto index = _mm512_setr_epi64(0, 4, 8, 12, 16, 20, 24, 28);
+    const auto zero = _mm512_setzero_si512();
+    const auto base = &values[0][0];
+    const auto w0 = _mm512_mask_i64gather_epi64(zero, 0xff, index, base + 0, 8);
+    const auto w1 = _mm512_mask_i64gather_epi64(zero, 0xff, index, base + 1, 8);
+    const auto w2 = _mm512_mask_i64gather_epi64(zero, 0xff, index, base + 2, 8);
+    const auto w3 = _mm512_mask_i64gather_epi64(zero, 0xff, index, base + 3, 8);
+
+    const auto mask = _mm512_set1_epi64(limb_mask);
+    l[0] = _mm512_and_si512(w0, mask);
+    l[1] = _mm512_and_si512(_mm512_or_si512(shr<52>(w0), shl<12>(w1)), mask);
+    l[2] = _mm512_and_si512(_mm512_or_si512(shr<40>(w1), shl<24>(w2)), mask);
+    l[3] = _mm512_and_si512(_mm512_or_si512(shr<28>(w2), shl<36>(w3)), mask);
+    l[4] = shr<16>(w3);
+}
+
+/// Transposes the normalized limbs back to words and stores 8 values.
+[[INTX_TARGET_AVX512_IFMA]] void store(uint256* values, const limbs& l) noexcept
+{
+    const auto index = _mm512_setr_epi64(0, 4, 8, 12, 16, 20, 24, 28);
+    const auto base = &values[0][0];
+    const auto w0 = _mm512_or_si512(l[0], shl<52>(l[1]));
+    const auto w1 = _mm512_or_si512(shr<12>(l[1]), shl<40>(l[2]));
+    const auto w2 = _mm512_or_si512(shr<24>(l[2]), shl<28>(l[3]));
+    const auto w3 = _mm512_or_si512(shr<36>(l[3]), shl<16>(l[4]));
+    _mm512_i64scatter_epi64(base + 0, index, w0, 8);
+    _mm512_i64scatter_epi64(base + 1, index, w1, 8);
+    _mm512_i64scatter_epi64(base + 2, index, w2, 8);
+    _mm512_i64scatter_epi64(base + 3, index, w3, 8);
+}
+
+/// Montgomery multiplication r = x·y·R^-1 mod m, R = 2^260, in the radix 2^52 (CIOS method).
+/// The x and y must be normalized and x·y < m·R. The result is normalized and less than 2m.
+[[INTX_TARGET_AVX512_IFMA]] void mont_mul(
+    limbs& r, const limbs& x, const limbs& y, const limbs& m, __m512i inv) noexcept
+{
+    const auto zero = _mm512_setzero_si512();
+    const auto mask = _mm512_set1_epi64(limb_mask);
+
+    __m512i t[num_limbs + 1];
+    for (auto& v : t)
+        v = zero;
+
+    for (size_t i = 0; i < num_limbs; ++i)
+    {
+        for (size_t j = 0; j < num_limbs; ++j)
+        {
+            t[j] = _mm512_madd52lo_epu64(t[j], x[j], y[i]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], x[j], y[i]);
+        }
+
+        // Only the low 52 bits of t[0] are used by the multiplication.
+        const auto q = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t[0], inv), mask);
+        for (size_t j = 0; j < num_limbs; ++j)
+        {
+            t[j] = _mm512_madd52lo_epu64(t[j], q, m[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], q, m[j]);
+        }
+
+        // The low 52 bits of t[0] are now zero. Shift the limbs and keep the carry.
+        const auto carry = shr<52>(t[0]);
+        t[0] = _mm512_add_epi64(t[1], carry);
+        for (size_t j = 1; j < num_limbs; ++j)
+            t[j] = t[j + 1];
+        t[num_limbs] = zero;
+    }
+
+    for (size_t j = 0; j < num_limbs - 1; ++j)
+    {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], shr<52>(t[j]));
+        r[j] = _mm512_and_si512(t[j], mask);
+    }
+    r[num_limbs - 1] = t[num_limbs - 1];
+}
+
+/// Subtracts m from the lanes of x not less than m.
+[[INTX_TARGET_AVX512_IFMA]] void reduce_once(limbs& x, const limbs& m) noexcept
+{
+    const auto mask = _mm512_set1_epi64(limb_mask);
+    limbs d;
+    auto borrow = _mm512_setzero_si512();
+    for (size_t j = 0; j < num_limbs; ++j)
+    {
+        const auto s = _mm512_sub_epi64(_mm512_sub_epi64(x[j], m[j]), borrow);
+        borrow = shr<63>(s);
+        d[j] = _mm512_and_si512(s, mask);
+    }
+
+    const auto less = _mm512_test_epi64_mask(borrow, borrow);
+    for (size_t j = 0; j < num_limbs; ++j)
+        x[j] = _mm512_mask_blend_epi64(less, d[j], x[j]);
+}
+
+/// Computes the modular products 8 at a time. The product c = x·y·R^-1 is less than 2m
+/// and is multiplied by R^2 mod m to get x·y mod m. The even moduli and the tail are handled
+/// by the portable implementation.
+[[INTX_TARGET_AVX512_IFMA]] void mulmod_batch(
+    const uint256* x, const uint256* y, size_t size, const uint256& mod, uint256* out) noexcept
+{
+    constexpr size_t lanes = 8;
+    if ((mod[0] & 1) == 0 || size < lanes)
+        return portable::mulmod_batch(x, y, size, mod, out);
+
+    const auto inv = inv_mod_2_64(mod[0]);
+
+    constexpr auto R2 = uint<576>{1} << (2 * 52 * num_limbs);
+    const auto r2 = to_limbs(static_cast<uint256>(udivrem(R2, uint<576>{mod}).rem));
+    const auto m = to_limbs(mod);
+
+    limbs r2v;
+    limbs mv;
+    for (size_t j = 0; j < num_limbs; ++j)
+    {
+        r2v[j] = _mm512_set1_epi64(static_cast<long long>(r2[j]));
+        mv[j] = _mm512_set1_epi64(static_cast<long long>(m[j]));
+    }
+    const auto invv = _mm512_set1_epi64(static_cast<long long>((0 - inv) & limb_mask));
+
+    size_t i = 0;
+    for (; i + lanes <= size; i += lanes)
+    {
+        auto bx = &x[i];
+        auto by = &y[i];
+
+        // The Montgomery multiplication requires reduced inputs.
+        bool reduced = true;
+        for (size_t k = 0; k < lanes; ++k)
+            reduced &= (bx[k] < mod) & (by[k] < mod);
+        uint256 rx[lanes];
+        uint256 ry[lanes];
+        if (!reduced)
+        {
+            for (size_t k = 0; k < lanes; ++k)
+            {
+                rx[k] = bx[k] < mod ? bx[k] : bx[k] % mod;
+                ry[k] = by[k] < mod ? by[k] : by[k] % mod;
+            }
+            bx = rx;
+            by = ry;
+        }
+
+        limbs a;
+        limbs b;
+        load(a, bx);
+        load(b, by);
+        mont_mul(a, a, b, mv, invv);
+        mont_mul(a, a, r2v, mv, invv);
+        reduce_once(a, mv);
+        store(&out[i], a);
+    }
+    portable::mulmod_batch(&x[i], &y[i], size - i, mod, &out[i]);
+}
+
+    #undef INTX_TARGET_AVX512_IFMA
+}  // namespace avx512_ifma
+#endif
+}  // namespace
+}  // namespace internal
+
+namespace dispatch
+{
+bool supported(variant v) noexcept
+{
+#if INTX_HAS_X86_64_ASM
+    switch (v)
+    {
+    case variant::avx512_ifma:
+        if (!__builtin_cpu_supports("avx512ifma"))
+            return false;
+        [[fallthrough]];
+    case variant::avx512:
+        if (!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512bw"))
+            return false;
+        [[fallthrough]];
+    case variant::avx2:
+        if (!__builtin_cpu_supports("avx2"))
+            return false;
+        [[fallthrough]];
+    case variant::bmi2_adx:
+        if (!__builtin_cpu_supports("bmi2") || !__builtin_cpu_supports("adx") ||
+            !__builtin_cpu_supports("lzcnt"))
+            return false;
+        [[fallthrough]];
+    case variant::portable:
+        return true;
+    }
+    return false;
+#else
+    return v == variant::portable;
+#endif
+}
+
+variant detect() noexcept
+{
+    for (const auto v : {variant::avx512_ifma, variant::avx512, variant::avx2, variant::bmi2_adx})
+    {
+        if (supported(v))
+            return v;
+    }
+    return variant::portable;
+}
+
+kernel_table make_kernel_table(variant v) noexcept
+{
+    kernel_table t{};
+    t.umul = internal::portable::umul;
+    t.udivrem = internal::portable::udivrem;
+    t.mulmod = internal::portable::mulmod;
+    t.addmod = internal::portable::addmod;
+    t.bswap = internal::portable::bswap;
+    t.hex_encode = internal::portable::hex_encode;
+    t.mulmod_batch = internal::portable::mulmod_batch;
+
+#if INTX_HAS_X86_64_ASM
+    if (v >= variant::bmi2_adx)
+    {
+        t.arithmetic = variant::bmi2_adx;
+        t.umul = internal::bmi2_adx::umul;
+        t.udivrem = internal::bmi2_adx::udivrem;
+        t.mulmod = internal::bmi2_adx::mulmod;
+        t.addmod = internal::bmi2_adx::addmod;
+    }
+    if (v >= variant::avx2)
+    {
+        t.bytes = variant::avx2;
+        t.bswap = internal::avx2::bswap;
+        t.hex_encode = internal::avx2::hex_encode;
+    }
+    if (v >= variant::avx512)
+    {
+        t.bytes = variant::avx512;
+        t.bswap = internal::avx512::bswap;
+        t.hex_encode = internal::avx512::hex_encode;
+    }
+    if (v >= variant::avx512_ifma)
+    {
+        t.batch = variant::avx512_ifma;
+        t.mulmod_batch = internal::avx512_ifma::mulmod_batch;
+    }
+#else
+    (void)v;
+#endif
+    return t;
+}
+
+const kernel_table& kernels() noexcept
+{
+    static const auto table = make_kernel_table(detect());
+    return table;
+}
+
+uint512 umul(const uint256& x, const uint256& y) noexcept
+{
+    return kernels().umul(x, y);
+}
+
+div_result<uint256> udivrem(const uint256& x, const uint256& y) noexcept
+{
+    return kernels().udivrem(x, y);
+}
+
+uint256 mulmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    return kernels().mulmod(x, y, mod);
+}
+
+uint256 addmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
+{
+    return kernels().addmod(x, y, mod);
+}
+
+void bswap(std::span<uint256> values) noexcept
+{
+    kernels().bswap(values.data(), values.size());
+}
+
+char* hex_encode(char* out, std::span<const uint8_t> bytes) noexcept
+{
+    return kernels().hex_encode(out, bytes.data(), bytes.size());
+}
+
+void mulmod_batch(std::span<const uint256> x, std::span<const uint256> y,
+    const uint256& mod, std::span<uint256> out) noexcept
+{
+    INTX_REQUIRE(x.size() == y.size() && out.size() == x.size());
+    kernels().mulmod_batch(x.data(), y.data(), x.size(), mod, out.data());
+}
+}  // namespace dispatch
+}  // namespace intx
@@ -0,0 +1,176 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Benchmarks of the runtime dispatched kernels.
+///
+/// Each kernel is benchmarked in all variants supported by the CPU. The variant selected by
+/// the dispatch is labeled "selected" and the speedup versus the portable variant is reported.
+
+#include <benchmark/benchmark.h>
+#include <intx/dispatch.hpp>
+#include <test/utils/random.hpp>
+#include <map>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+constexpr dispatch::variant all_variants[] = {dispatch::variant::portable,
+    dispatch::variant::bmi2_adx, dispatch::variant::avx2, dispatch::variant::avx512,
+    dispatch::variant::avx512_ifma};
+
+template <auto Fn>
+void binop(benchmark::State& state, const dispatch::kernel_table& t)
+{
+    const auto& xs = get_samples<uint256>(x_256);
+    const auto& ys = get_samples<uint256>(lt_256);
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            auto _ = (t.*Fn)(xs[i], ys[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+
+template <auto Fn>
+void modop(benchmark::State& state, const dispatch::kernel_table& t)
+{
+    const auto& xs = get_samples<uint256>(x_256);
+    const auto& ys = get_samples<uint256>(y_256);
+    const auto& ms = get_samples<uint256>(lt_256);
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            auto _ = (t.*Fn)(xs[i], ys[i], ms[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+
+void bulk_bswap(benchmark::State& state, const dispatch::kernel_table& t)
+{
+    auto values = get_samples<uint256>(x_256);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        t.bswap(values.data(), values.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(sizeof(values)));
+}
+
+void bulk_hex_encode(benchmark::State& state, const dispatch::kernel_table& t)
+{
+    const auto& values = get_samples<uint256>(x_256);
+    const auto bytes = as_bytes(values);
+    std::vector<char> out(2 * sizeof(values));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        t.hex_encode(out.data(), bytes, sizeof(values));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(sizeof(values)));
+}
+
+void mulmod_batch(benchmark::State& state, const dispatch::kernel_table& t)
+{
+    const auto& xs = get_samples<uint256>(x_256);
+    const auto& ys = get_samples<uint256>(y_256);
+    const auto mod = get_samples<uint256>(x_256)[0] | 1;
+    std::vector<uint256> out(xs.size());
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        t.mulmod_batch(xs.data(), ys.data(), xs.size(), mod, out.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+/// Console reporter adding the "speedup" counter relative to the portable variant.
+class speedup_reporter : public benchmark::ConsoleReporter
+{
+    std::map<std::string, double> portable_times_;
+
+public:
+    void ReportRuns(const std::vector<Run>& reports) override
+    {
+        auto runs = reports;
+        for (auto& run : runs)
+        {
+            // The name format is kernel/variant[/selected].
+            const auto name = run.benchmark_name();
+            const auto sep = name.find('/');
+            const auto kernel = name.substr(0, sep);
+            const auto variant = name.substr(sep + 1, name.find('/', sep + 1) - sep - 1);
+            const auto time = run.GetAdjustedRealTime();
+            if (variant == dispatch::to_string(dispatch::variant::portable))
+                portable_times_[kernel] = time;
+            if (const auto it = portable_times_.find(kernel); it != portable_times_.end())
+                run.counters["speedup"] = it->second / time;
+        }
+        ConsoleReporter::ReportRuns(runs);
+    }
+};
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+
+    const auto& selected = dispatch::kernels();
+    benchmark::AddCustomContext("intx_cpu_variant", dispatch::to_string(dispatch::detect()));
+    benchmark::AddCustomContext("intx_arithmetic", dispatch::to_string(selected.arithmetic));
+    benchmark::AddCustomContext("intx_bytes", dispatch::to_string(selected.bytes));
+    benchmark::AddCustomContext("intx_batch", dispatch::to_string(selected.batch));
+
+    struct kernel
+    {
+        const char* name;
+        void (*fn)(benchmark::State&, const dispatch::kernel_table&);
+        dispatch::variant dispatch::kernel_table::*group;
+    };
+    using table = dispatch::kernel_table;
+    const kernel kernels[] = {
+        {"umul", binop<&table::umul>, &table::arithmetic},
+        {"udivrem", binop<&table::udivrem>, &table::arithmetic},
+        {"mulmod", modop<&table::mulmod>, &table::arithmetic},
+        {"addmod", modop<&table::addmod>, &table::arithmetic},
+        {"bswap", bulk_bswap, &table::bytes},
+        {"hex_encode", bulk_hex_encode, &table::bytes},
+        {"mulmod_batch", mulmod_batch, &table::batch},
+    };
+
+    for (const auto& [kernel_name, fn, group] : kernels)
+    {
+        for (const auto v : all_variants)
+        {
+            if (!dispatch::supported(v))
+                continue;
+
+            // Skip the variants not having own implementation of the kernel.
+            const auto t = dispatch::make_kernel_table(v);
+            if (t.*group != v)
+                continue;
+
+            const auto name = std::string{kernel_name} + "/" + dispatch::to_string(v);
+            auto* b = benchmark::RegisterBenchmark(
+                name.c_str(), [fn, t](benchmark::State& state) { fn(state, t); });
+            if (v == selected.*group)
+                b->Name(name + "/selected");
+        }
+    }
+
+    speedup_reporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+    return 0;
+}
@@ -5,6 +5,7 @@
 #include <benchmark/benchmark.h>
 #include <experimental/div.hpp>
 #include <intx/intx.hpp>
+#include <test/utils/gmp.hpp>
 #include <test/utils/random.hpp>
 
 using namespace intx;
@@ -122,6 +123,153 @@ void udiv64(benchmark::State& state)
     }
 }
 
+/// Divides the set of numerators by the same divisor, with or without the cached divider.
+template <bool UseDivider>
+void div_by_same(benchmark::State& state)
+{
+    const auto divisor_set_id = [&state]() noexcept {
+        switch (state.range(0))
+        {
+        case 64:
+            return test::x_64;
+        case 128:
+            return test::x_128;
+        case 192:
+            return test::x_192;
+        case 256:
+            return test::x_256;
+        default:
+            state.SkipWithError("unexpected argument");
+            return test::x_64;
+        }
+    }();
+
+    const auto& xs = test::get_samples<uint512>(test::x_512);
+    const auto y = test::get_samples<uint256>(divisor_set_id)[0];
+    const divider<256> d{y};
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (const auto& x : xs)
+        {
+            auto _ = UseDivider ? d.divrem(x) : udivrem(x, y);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(div_by_same<false>)->DenseRange(64, 256, 64);
+BENCHMARK(div_by_same<true>)->DenseRange(64, 256, 64);
+
+template <unsigned M, unsigned N>
+[[gnu::noinline]] auto udivrem_(const intx::uint<M>& x, const intx::uint<N>& y) noexcept
+{
+    return udivrem(x, y);
+}
+
+/// Divides the full-width numerators by the divisors of the given number of bits.
+template <unsigned M, unsigned N,
+    div_result<intx::uint<M>, intx::uint<N>> DivFn(const intx::uint<M>&, const intx::uint<N>&)>
+void div_wide(benchmark::State& state)
+{
+    const auto divisor_bits = static_cast<unsigned>(state.range(0));
+    std::mt19937_64 rng{test::get_seed()};
+    std::vector<intx::uint<M>> xs(32);
+    std::vector<intx::uint<N>> ys(xs.size());
+    for (size_t i = 0; i < xs.size(); ++i)
+    {
+        std::ranges::generate(as_words(xs[i]), std::ref(rng));
+        std::ranges::generate(as_words(ys[i]), std::ref(rng));
+        ys[i] >>= N - divisor_bits;
+    }
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            auto _ = DivFn(xs[i], ys[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(div_wide<2048, 1024, udivrem_>)->Arg(1024);
+BENCHMARK(div_wide<2048, 1024, gmp::udivrem>)->Arg(1024);
+BENCHMARK(div_wide<4096, 2048, udivrem_>)->Arg(1024)->Arg(1600)->Arg(2048);
+BENCHMARK(div_wide<4096, 2048, gmp::udivrem>)->Arg(1024)->Arg(1600)->Arg(2048);
+BENCHMARK(div_wide<8192, 4096, udivrem_>)->Arg(2048)->Arg(3200)->Arg(4096);
+BENCHMARK(div_wide<8192, 4096, gmp::udivrem>)->Arg(2048)->Arg(3200)->Arg(4096);
+BENCHMARK(div_wide<16384, 8192, udivrem_>)->Arg(4096)->Arg(6400)->Arg(8192);
+BENCHMARK(div_wide<16384, 8192, gmp::udivrem>)->Arg(4096)->Arg(6400)->Arg(8192);
+
+[[gnu::noinline]] auto div_e18(const uint256& x) noexcept
+{
+    return udivrem(x, uint256{1000000000000000000});
+}
+
+[[gnu::noinline]] auto div_e18_const(const uint256& x) noexcept
+{
+    return udivrem_const<1000000000000000000>(x);
+}
+
+[[gnu::noinline]] auto div_e38(const uint256& x) noexcept
+{
+    return udivrem(x, 100000000000000000000000000000000000000_u256);
+}
+
+[[gnu::noinline]] auto div_e38_const(const uint256& x) noexcept
+{
+    constexpr constant_divider<256> d{100000000000000000000000000000000000000_u256};
+    return d.divrem(x);
+}
+
+template <div_result<uint256> DivFn(const uint256&)>
+void div_by_const(benchmark::State& state)
+{
+    const auto& xs = test::get_samples<uint256>(test::x_256);
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (const auto& x : xs)
+        {
+            auto _ = DivFn(x);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(div_by_const<div_e18>);
+BENCHMARK(div_by_const<div_e18_const>);
+BENCHMARK(div_by_const<div_e38>);
+BENCHMARK(div_by_const<div_e38_const>);
+
+[[gnu::noinline]] uint256 muldiv_widened(const uint256& a, const uint256& b, const uint256& c)
+{
+    const auto q = udivrem(umul(a, b), uint512{c}).quot;
+    return q >> 256 == 0 ? static_cast<uint256>(q) : 0;
+}
+
+[[gnu::noinline]] uint256 muldiv_floor(const uint256& a, const uint256& b, const uint256& c)
+{
+    return muldiv(a, b, c).value;
+}
+
+template <uint256 MulDivFn(const uint256&, const uint256&, const uint256&)>
+void muldiv(benchmark::State& state)
+{
+    const auto& as = test::get_samples<uint256>(test::x_128);
+    const auto& bs = test::get_samples<uint256>(test::y_256);
+    const auto& cs = test::get_samples<uint256>(test::x_256);
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(as.size())))
+    {
+        for (size_t i = 0; i < as.size(); ++i)
+        {
+            auto _ = MulDivFn(as[i], bs[i], cs[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(muldiv<muldiv_widened>);
+BENCHMARK(muldiv<muldiv_floor>);
+
 BENCHMARK(udiv64<nop>);
 BENCHMARK(udiv64<udiv_by_reciprocal>);
 BENCHMARK(udiv64<udiv_native>);
@@ -4,7 +4,10 @@
 
 #include "../experimental/addmod.hpp"
 #include <benchmark/benchmark.h>
+#include <intx/batch.hpp>
 #include <intx/intx.hpp>
+#include <intx/sort.hpp>
+#include <intx/sorted_index.hpp>
 #include <test/utils/gmp.hpp>
 #include <test/utils/random.hpp>
 
@@ -149,6 +152,197 @@ BENCHMARK(ecmod<addmod_daosvik_v1>);
 BENCHMARK(ecmod<addmod_daosvik_v2>);
 BENCHMARK(ecmod<mulmod>);
 
+/// The BN254 base field prime.
+constexpr auto bn254_p = 0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47_u256;
+
+/// Modular multiplication with the fixed modulus and inputs reduced by it.
+template <uint256 MulModFn(const uint256&, const uint256&, const uint256&)>
+void mulmod_fixed(benchmark::State& state)
+{
+    const auto& m = bn254_p;
+    std::array<uint256, num_samples> xs{};
+    std::array<uint256, num_samples> ys{};
+    std::ranges::transform(get_samples<uint256>(x_256), xs.begin(), [&](auto x) { return x % m; });
+    std::ranges::transform(get_samples<uint256>(y_256), ys.begin(), [&](auto y) { return y % m; });
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            auto _ = MulModFn(xs[i], ys[i], m);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(mulmod_fixed<mulmod>);
+BENCHMARK(mulmod_fixed<gmp::mulmod>);
+
+/// Modular multiplication with the fixed modulus using the Montgomery form.
+/// The conversion to and from the Montgomery form is not measured.
+void mulmod_montgomery(benchmark::State& state)
+{
+    const montgomery<256> mont{bn254_p};
+    std::array<uint256, num_samples> xs{};
+    std::array<uint256, num_samples> ys{};
+    std::ranges::transform(get_samples<uint256>(x_256), xs.begin(), [&](auto x) {
+        return mont.to_mont(x);
+    });
+    std::ranges::transform(get_samples<uint256>(y_256), ys.begin(), [&](auto y) {
+        return mont.to_mont(y);
+    });
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            auto _ = mont.mul(xs[i], ys[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(mulmod_montgomery);
+
+/// Modular squaring using the Montgomery form: the dedicated sqr() vs mul(x, x).
+template <bool UseSqr>
+void sqrmod_montgomery(benchmark::State& state)
+{
+    const montgomery<256> mont{bn254_p};
+    std::array<uint256, num_samples> xs{};
+    std::ranges::transform(get_samples<uint256>(x_256), xs.begin(), [&](auto x) {
+        return mont.to_mont(x);
+    });
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            auto _ = UseSqr ? mont.sqr(xs[i]) : mont.mul(xs[i], xs[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(sqrmod_montgomery<false>);
+BENCHMARK(sqrmod_montgomery<true>);
+
+/// Modular multiplication with the fixed modulus and inputs reduced by it,
+/// using the precomputed divider<256> or barrett<256>. Compare with mulmod_fixed<mulmod>.
+template <typename Reducer>
+void mulmod_reducer(benchmark::State& state)
+{
+    const auto& m = bn254_p;
+    const Reducer r{m};
+    std::array<uint256, num_samples> xs{};
+    std::array<uint256, num_samples> ys{};
+    std::ranges::transform(get_samples<uint256>(x_256), xs.begin(), [&](auto x) { return x % m; });
+    std::ranges::transform(get_samples<uint256>(y_256), ys.begin(), [&](auto y) { return y % m; });
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            uint256 _;
+            if constexpr (std::is_same_v<Reducer, barrett<256>>)
+                _ = mulmod(xs[i], ys[i], r);
+            else
+                _ = r.rem(umul(xs[i], ys[i]));
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(mulmod_reducer<divider<256>>);
+BENCHMARK(mulmod_reducer<barrett<256>>);
+
+/// Modular exponentiation by the square-and-multiply loop of mulmod().
+template <unsigned N>
+[[gnu::noinline]] intx::uint<N> powmod_mulmod(
+    const intx::uint<N>& base, const intx::uint<N>& exp, const intx::uint<N>& mod) noexcept
+{
+    auto result = intx::uint<N>{1};
+    for (auto i = bit_width(exp); i != 0; --i)
+    {
+        result = udivrem(sqr_full(result), mod).rem;
+        if (bit_test(exp, i - 1))
+            result = udivrem(umul(result, base), mod).rem;
+    }
+    return result;
+}
+
+template <unsigned N>
+[[gnu::noinline]] intx::uint<N> powmod_(
+    const intx::uint<N>& base, const intx::uint<N>& exp, const intx::uint<N>& mod) noexcept
+{
+    return powmod(base, exp, mod);
+}
+
+/// Modular exponentiation with full-width exponents and an odd (arg 1) or even (arg 0) modulus.
+template <unsigned N,
+    intx::uint<N> PowModFn(const intx::uint<N>&, const intx::uint<N>&, const intx::uint<N>&)>
+void powmod(benchmark::State& state)
+{
+    std::mt19937_64 rng{get_seed()};
+    std::array<intx::uint<N>, 4> bs;
+    std::array<intx::uint<N>, bs.size()> es;
+    std::array<intx::uint<N>, bs.size()> ms;
+    for (size_t i = 0; i < bs.size(); ++i)
+    {
+        std::ranges::generate(as_words(bs[i]), std::ref(rng));
+        std::ranges::generate(as_words(es[i]), std::ref(rng));
+        std::ranges::generate(as_words(ms[i]), std::ref(rng));
+        ms[i] = state.range(0) != 0 ? (ms[i] | 1) : (ms[i] & ~intx::uint<N>{1});
+        bs[i] %= ms[i];
+    }
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(bs.size())))
+    {
+        for (size_t i = 0; i < bs.size(); ++i)
+        {
+            auto _ = PowModFn(bs[i], es[i], ms[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(powmod<256, powmod_mulmod>)->Arg(1)->Arg(0);
+BENCHMARK(powmod<256, powmod_>)->Arg(1)->Arg(0);
+BENCHMARK(powmod<256, gmp::powmod>)->Arg(1)->Arg(0);
+BENCHMARK(powmod<1024, powmod_mulmod>)->Arg(1)->Arg(0);
+BENCHMARK(powmod<1024, powmod_>)->Arg(1)->Arg(0);
+BENCHMARK(powmod<1024, gmp::powmod>)->Arg(1)->Arg(0);
+BENCHMARK(powmod<2048, powmod_>)->Arg(1)->Arg(0);
+BENCHMARK(powmod<2048, gmp::powmod>)->Arg(1)->Arg(0);
+
+/// Fixed-base modular exponentiation with the precomputed comb table (the construction
+/// is not measured) and full-width exponents. Compare with powmod<N, powmod_>.
+template <unsigned N, unsigned H, unsigned V>
+void fixed_base_powmod(benchmark::State& state)
+{
+    std::mt19937_64 rng{get_seed()};
+    intx::uint<N> base;
+    intx::uint<N> mod;
+    std::ranges::generate(as_words(base), std::ref(rng));
+    std::ranges::generate(as_words(mod), std::ref(rng));
+    mod = state.range(0) != 0 ? (mod | 1) : (mod & ~intx::uint<N>{1});
+    const intx::fixed_base_powmod<N, H, V> p{base % mod, mod};
+
+    std::array<intx::uint<N>, 4> es;
+    for (auto& e : es)
+        std::ranges::generate(as_words(e), std::ref(rng));
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(es.size())))
+    {
+        for (const auto& e : es)
+        {
+            auto _ = p.pow(e);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(fixed_base_powmod<256, 4, 2>)->Arg(1)->Arg(0);
+BENCHMARK(fixed_base_powmod<256, 5, 2>)->Arg(1)->Arg(0);
+BENCHMARK(fixed_base_powmod<256, 6, 4>)->Arg(1)->Arg(0);
+BENCHMARK(fixed_base_powmod<1024, 5, 2>)->Arg(1)->Arg(0);
+BENCHMARK(fixed_base_powmod<2048, 4, 2>)->Arg(1)->Arg(0);
+BENCHMARK(fixed_base_powmod<2048, 5, 2>)->Arg(1)->Arg(0);
+BENCHMARK(fixed_base_powmod<2048, 6, 4>)->Arg(1)->Arg(0);
 
 template <unsigned N>
 [[gnu::noinline]] auto public_mul(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
@@ -185,11 +379,82 @@ inline auto inline_sub(const uint512& x, const uint512& y) noexcept
 }
 
 
+template <unsigned N>
+[[gnu::noinline]] auto mul_self(const intx::uint<N>& x) noexcept
+{
+    return x * x;
+}
+
+template <unsigned N>
+[[gnu::noinline]] auto sqr_(const intx::uint<N>& x) noexcept
+{
+    return intx::sqr(x);
+}
+
+template <unsigned N>
+[[gnu::noinline]] auto umul_self(const intx::uint<N>& x) noexcept
+{
+    return intx::umul(x, x);
+}
+
+template <unsigned N>
+[[gnu::noinline]] auto sqr_full_(const intx::uint<N>& x) noexcept
+{
+    return intx::sqr_full(x);
+}
+
+template <typename ResultT, typename ArgT, ResultT UnOp(const ArgT&)>
+void unop(benchmark::State& state)
+{
+    const auto& xs = test::get_samples<ArgT>(sizeof(ArgT) == sizeof(uint256) ? x_256 : x_512);
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        for (const auto& x : xs)
+        {
+            auto _ = UnOp(x);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK(unop<uint256, uint256, mul_self>);
+BENCHMARK(unop<uint256, uint256, sqr_>);
+BENCHMARK(unop<uint512, uint256, umul_self>);
+BENCHMARK(unop<uint512, uint256, sqr_full_>);
+BENCHMARK(unop<uint512, uint512, mul_self>);
+BENCHMARK(unop<uint512, uint512, sqr_>);
+
+/// Random full-width samples of the types wider than uint512.
+template <typename Int>
+const std::vector<Int>& get_wide_samples(size_t index)
+{
+    static const auto samples = [] {
+        std::array<std::vector<Int>, 2> s;
+        std::mt19937_64 rng{get_seed()};
+        for (auto& v : s)
+        {
+            v.resize(64);
+            for (auto& x : v)
+                std::ranges::generate(as_words(x), std::ref(rng));
+        }
+        return s;
+    }();
+    return samples[index];
+}
+
 template <typename ResultT, typename ArgT, ResultT BinOp(const ArgT&, const ArgT&)>
 void binop(benchmark::State& state)
 {
-    const auto& xs = test::get_samples<ArgT>(sizeof(ArgT) == sizeof(uint256) ? x_256 : x_512);
-    const auto& ys = test::get_samples<ArgT>(sizeof(ArgT) == sizeof(uint256) ? y_256 : y_512);
+    const auto& [xs, ys] = [] {
+        if constexpr (sizeof(ArgT) > sizeof(uint512))
+            return std::tie(get_wide_samples<ArgT>(0), get_wide_samples<ArgT>(1));
+        else
+        {
+            constexpr auto is_256 = sizeof(ArgT) == sizeof(uint256);
+            return std::tie(test::get_samples<ArgT>(is_256 ? x_256 : x_512),
+                test::get_samples<ArgT>(is_256 ? y_256 : y_512));
+        }
+    }();
 
     while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
     {
@@ -217,6 +482,38 @@ BENCHMARK(binop<uint512, uint512, inline_sub>);
 BENCHMARK(binop<uint512, uint512, public_mul>);
 BENCHMARK(binop<uint512, uint512, gmp::mul>);
 
+BENCHMARK(binop<uint1024, uint512, umul_>);
+BENCHMARK(binop<uint1024, uint512, gmp::mul_full>);
+BENCHMARK(binop<uint1024, uint1024, public_mul>);
+BENCHMARK(binop<uint1024, uint1024, gmp::mul>);
+BENCHMARK(binop<uint2048, uint1024, umul_>);
+BENCHMARK(binop<uint2048, uint1024, gmp::mul_full>);
+BENCHMARK(binop<uint2048, uint2048, public_mul>);
+BENCHMARK(binop<uint2048, uint2048, gmp::mul>);
+BENCHMARK(binop<uint4096, uint2048, umul_>);
+BENCHMARK(binop<uint4096, uint2048, gmp::mul_full>);
+BENCHMARK(binop<uint4096, uint4096, public_mul>);
+BENCHMARK(binop<uint4096, uint4096, gmp::mul>);
+
+using uint8192 = intx::uint<8192>;
+using uint16384 = intx::uint<16384>;
+using uint32768 = intx::uint<32768>;
+using uint65536 = intx::uint<65536>;
+BENCHMARK(binop<uint8192, uint4096, umul_>);
+BENCHMARK(binop<uint8192, uint4096, gmp::mul_full>);
+BENCHMARK(binop<uint8192, uint8192, public_mul>);
+BENCHMARK(binop<uint8192, uint8192, gmp::mul>);
+BENCHMARK(binop<uint16384, uint8192, umul_>);
+BENCHMARK(binop<uint16384, uint8192, gmp::mul_full>);
+BENCHMARK(binop<uint16384, uint16384, public_mul>);
+BENCHMARK(binop<uint16384, uint16384, gmp::mul>);
+BENCHMARK(binop<uint32768, uint16384, umul_>);
+BENCHMARK(binop<uint32768, uint16384, gmp::mul_full>);
+BENCHMARK(binop<uint32768, uint32768, public_mul>);
+BENCHMARK(binop<uint32768, uint32768, gmp::mul>);
+BENCHMARK(binop<uint65536, uint32768, umul_>);
+BENCHMARK(binop<uint65536, uint32768, gmp::mul_full>);
+
 template <unsigned N>
 [[gnu::noinline]] intx::uint<N> shl_public(const intx::uint<N>& x, const uint64_t& y) noexcept
 {
@@ -490,6 +787,52 @@ BENCHMARK(compare<lt_halves>)->DenseRange(0, 256, 64);
 BENCHMARK(compare<lt_llvm>)->DenseRange(0, 256, 64);
 #endif
 
+/// Adds the columns of values element-wise and counts the overflows,
+/// with uint256 one by one or with the columns stored as uint_batch of 8 lanes.
+template <bool UseBatch>
+void add_columns(benchmark::State& state)
+{
+    using batch = uint_batch<256, 8>;
+    const auto& xs = test::get_samples<uint256>(x_256);
+    const auto& ys = test::get_samples<uint256>(y_256);
+    std::vector<uint256> out(xs.size());
+
+    std::vector<batch> xb;
+    std::vector<batch> yb;
+    for (size_t i = 0; i + batch::num_lanes <= xs.size(); i += batch::num_lanes)
+    {
+        xb.emplace_back(batch::gather(&xs[i]));
+        yb.emplace_back(batch::gather(&ys[i]));
+    }
+    std::vector<batch> outb(xb.size());
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(xs.size())))
+    {
+        uint64_t overflows = 0;
+        if constexpr (UseBatch)
+        {
+            for (size_t i = 0; i < xb.size(); ++i)
+            {
+                outb[i] = xb[i] + yb[i];
+                overflows += static_cast<uint64_t>(std::popcount(cmp_lt(outb[i], xb[i])));
+            }
+            benchmark::DoNotOptimize(outb.data());
+        }
+        else
+        {
+            for (size_t i = 0; i < xs.size(); ++i)
+            {
+                out[i] = xs[i] + ys[i];
+                overflows += out[i] < xs[i];
+            }
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::DoNotOptimize(overflows);
+    }
+}
+BENCHMARK(add_columns<false>);
+BENCHMARK(add_columns<true>);
+
 void exponentiation(benchmark::State& state)
 {
     const auto exponent_set_id = [&state]() noexcept {
@@ -577,6 +920,120 @@ BENCHMARK(to_string<uint128>);
 BENCHMARK(to_string<uint256>);
 BENCHMARK(to_string<uint512>);
 
+template <typename Int>
+void to_chars(benchmark::State& state)
+{
+    const auto base = static_cast<int>(state.range(0));
+    lcg<Int> rng(get_seed());
+
+    constexpr size_t size = 1000;
+    std::vector<Int> input(size);
+    for (auto& x : input)
+        x = rng();
+
+    char buffer[sizeof(Int) * 8];
+    while (state.KeepRunningBatch(size))
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            auto r = intx::to_chars(std::begin(buffer), std::end(buffer), input[i], base);
+            benchmark::DoNotOptimize(r.ptr);
+            benchmark::ClobberMemory();
+        }
+    }
+}
+BENCHMARK(to_chars<uint128>)->Arg(10)->Arg(16);
+BENCHMARK(to_chars<uint256>)->Arg(10)->Arg(16);
+BENCHMARK(to_chars<uint512>)->Arg(10)->Arg(16);
+
+template <typename Int>
+void from_string(benchmark::State& state)
+{
+    const auto base = static_cast<int>(state.range(0));
+    lcg<Int> rng(get_seed());
+
+    constexpr size_t size = 1000;
+    std::vector<std::string> input(size);
+    for (auto& s : input)
+        s = (base == 16 ? "0x" : "") + intx::to_string(rng(), base);
+
+    while (state.KeepRunningBatch(size))
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            auto x = intx::from_string<Int>(input[i]);
+            benchmark::DoNotOptimize(x);
+        }
+    }
+}
+BENCHMARK(from_string<uint128>)->Arg(10)->Arg(16);
+BENCHMARK(from_string<uint256>)->Arg(10)->Arg(16);
+BENCHMARK(from_string<uint512>)->Arg(10)->Arg(16);
+
+void hex_uint256(benchmark::State& state)
+{
+    const auto& input = get_samples<uint256>(x_256);
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(input.size())))
+    {
+        for (const auto& x : input)
+        {
+            auto s = "0x" + intx::hex(x);
+            benchmark::DoNotOptimize(s.data());
+        }
+    }
+}
+BENCHMARK(hex_uint256);
+
+void to_hex_chars_uint256(benchmark::State& state)
+{
+    const auto& input = get_samples<uint256>(x_256);
+    char buffer[66];
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(input.size())))
+    {
+        for (const auto& x : input)
+        {
+            auto r = intx::to_hex_chars(std::begin(buffer), std::end(buffer), x);
+            benchmark::DoNotOptimize(r.ptr);
+            benchmark::ClobberMemory();
+        }
+    }
+}
+BENCHMARK(to_hex_chars_uint256);
+
+void to_hex_chars_uint256_batch(benchmark::State& state)
+{
+    const auto& input = get_samples<uint256>(x_256);
+    std::vector<char> buffer(input.size() * 67);
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(input.size())))
+    {
+        auto r = intx::to_hex_chars(
+            buffer.data(), buffer.data() + buffer.size(), std::span<const uint256>{input});
+        benchmark::DoNotOptimize(r.ptr);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(to_hex_chars_uint256_batch);
+
+void from_hex_chars_uint256(benchmark::State& state)
+{
+    const auto& input = get_samples<uint256>(x_256);
+    std::vector<std::string> strings;
+    for (const auto& x : input)
+        strings.emplace_back("0x" + intx::hex(x));
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(strings.size())))
+    {
+        for (const auto& s : strings)
+        {
+            uint256 x;
+            auto r = intx::from_hex_chars(s.data(), s.data() + s.size(), x);
+            benchmark::DoNotOptimize(r.ptr);
+            benchmark::DoNotOptimize(x);
+        }
+    }
+}
+BENCHMARK(from_hex_chars_uint256);
+
 
 template <typename Int>
 [[gnu::noinline]] auto load_be(const uint8_t* data) noexcept
@@ -607,6 +1064,341 @@ void load_store_be(benchmark::State& state)
 BENCHMARK(load_store_be<uint128>);
 BENCHMARK(load_store_be<uint256>);
 BENCHMARK(load_store_be<uint512>);
+
+/// Loads and stores the array of big-endian words one by one (Arg 0) or in bulk (Arg 1).
+template <typename Int>
+void load_store_be_n(benchmark::State& state)
+{
+    constexpr size_t n = 256;
+    const auto bulk = state.range(0) != 0;
+    std::vector<uint8_t> bytes(n * sizeof(Int) + 1);
+    const auto unaligned = std::span{bytes}.subspan(1);
+    std::vector<Int> values(n);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        if (bulk)
+        {
+            intx::be::load_n(unaligned, std::span{values});
+            intx::be::store_n<Int::num_bits>(unaligned, values);
+        }
+        else
+        {
+            for (size_t i = 0; i < n; ++i)
+                values[i] = intx::be::unsafe::load<Int>(&unaligned[i * sizeof(Int)]);
+            for (size_t i = 0; i < n; ++i)
+                intx::be::unsafe::store(&unaligned[i * sizeof(Int)], values[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(load_store_be_n<uint128>)->Arg(0)->Arg(1);
+BENCHMARK(load_store_be_n<uint256>)->Arg(0)->Arg(1);
+BENCHMARK(load_store_be_n<uint512>)->Arg(0)->Arg(1);
+
+/// Returns the values with the given number of significant bytes
+/// or with the number uniformly distributed in [1, 32] for 0.
+std::vector<uint256> minimal_inputs(int64_t num_bytes)
+{
+    lcg<uint256> rng(get_seed());
+    lcg<uint64_t> rng_size(get_seed());
+    std::vector<uint256> input(1000);
+    for (auto& x : input)
+    {
+        const auto n = num_bytes != 0 ? static_cast<unsigned>(num_bytes) :
+                                        static_cast<unsigned>(rng_size() >> 59) + 1;
+        x = (rng() >> (256 - 8 * n)) | (uint256{1} << (8 * n - 1));
+    }
+    return input;
+}
+
+/// The store of the minimal form with the full store to the temporary buffer.
+[[gnu::noinline]] size_t store_minimal_memmove(uint8_t* dst, const uint256& x) noexcept
+{
+    const size_t size = count_significant_bytes(x);
+    uint8_t tmp[sizeof(x)];
+    intx::be::store(tmp, x);
+    std::memmove(dst, &tmp[sizeof(x) - size], size);
+    return size;
+}
+
+[[gnu::noinline]] size_t store_minimal(uint8_t* dst, const uint256& x) noexcept
+{
+    return intx::be::store_minimal(dst, x);
+}
+
+template <size_t StoreFn(uint8_t*, const uint256&) noexcept>
+void store_minimal(benchmark::State& state)
+{
+    const auto input = minimal_inputs(state.range(0));
+    uint8_t buffer[sizeof(uint256)];
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(input.size())))
+    {
+        for (const auto& x : input)
+        {
+            benchmark::DoNotOptimize(StoreFn(buffer, x));
+            benchmark::ClobberMemory();
+        }
+    }
+}
+BENCHMARK(store_minimal<store_minimal_memmove>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+BENCHMARK(store_minimal<store_minimal>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+
+[[gnu::noinline]] uint256 load_span(std::span<const uint8_t> src) noexcept
+{
+    return intx::be::load<uint256>(src);
+}
+
+[[gnu::noinline]] uint256 load_minimal(std::span<const uint8_t> src) noexcept
+{
+    return intx::be::load_minimal<uint256>(src).value_or(0);
+}
+
+template <uint256 LoadFn(std::span<const uint8_t>) noexcept>
+void load_minimal(benchmark::State& state)
+{
+    const auto input = minimal_inputs(state.range(0));
+    std::vector<uint8_t> bytes(input.size() * sizeof(uint256));
+    std::vector<std::span<const uint8_t>> encoded;
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        const auto p = &bytes[i * sizeof(uint256)];
+        encoded.emplace_back(p, intx::be::store_minimal(p, input[i]));
+    }
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(encoded.size())))
+    {
+        for (const auto& e : encoded)
+            benchmark::DoNotOptimize(LoadFn(e));
+    }
+}
+BENCHMARK(load_minimal<load_span>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+BENCHMARK(load_minimal<load_minimal>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+
+/// The LEB128 encoding one 7-bit group at a time.
+[[gnu::noinline]] size_t varint_encode_bytewise(uint8_t* out, const uint256& x) noexcept
+{
+    auto v = x;
+    size_t i = 0;
+    for (; v >= 0x80; v >>= 7)
+        out[i++] = static_cast<uint8_t>(v) | 0x80;
+    out[i++] = static_cast<uint8_t>(v);
+    return i;
+}
+
+[[gnu::noinline]] size_t varint_encode(uint8_t* out, const uint256& x) noexcept
+{
+    return intx::varint::encode(x, out);
+}
+
+template <size_t EncodeFn(uint8_t*, const uint256&) noexcept>
+void varint_encode(benchmark::State& state)
+{
+    const auto input = minimal_inputs(state.range(0));
+    uint8_t buffer[varint::max_size<256>];
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(input.size())))
+    {
+        for (const auto& x : input)
+        {
+            benchmark::DoNotOptimize(EncodeFn(buffer, x));
+            benchmark::ClobberMemory();
+        }
+    }
+}
+BENCHMARK(varint_encode<varint_encode_bytewise>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+BENCHMARK(varint_encode<varint_encode>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+
+/// The LEB128 decoding one 7-bit group at a time.
+[[gnu::noinline]] uint256 varint_decode_bytewise(std::span<const uint8_t> in) noexcept
+{
+    uint256 r;
+    for (size_t i = 0; i < in.size(); ++i)
+    {
+        r |= uint256{in[i] & 0x7fu} << (7 * i);
+        if ((in[i] & 0x80) == 0)
+            break;
+    }
+    return r;
+}
+
+[[gnu::noinline]] uint256 varint_decode(std::span<const uint8_t> in) noexcept
+{
+    uint256 r;
+    intx::varint::decode(in, r);
+    return r;
+}
+
+template <uint256 DecodeFn(std::span<const uint8_t>) noexcept>
+void varint_decode(benchmark::State& state)
+{
+    const auto input = minimal_inputs(state.range(0));
+    constexpr auto max_size = varint::max_size<256>;
+    std::vector<uint8_t> bytes(input.size() * max_size);
+    std::vector<std::span<const uint8_t>> encoded;
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        const auto p = &bytes[i * max_size];
+        encoded.emplace_back(p, intx::varint::encode(input[i], p));
+    }
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(encoded.size())))
+    {
+        for (const auto& e : encoded)
+            benchmark::DoNotOptimize(DecodeFn(e));
+    }
+}
+BENCHMARK(varint_decode<varint_decode_bytewise>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+BENCHMARK(varint_decode<varint_decode>)->Arg(0)->Arg(1)->Arg(8)->Arg(20)->Arg(32);
+
+/// The common hand-written hasher: the low word only.
+template <typename Int>
+[[gnu::noinline]] uint64_t hash_low_word(const Int& x) noexcept
+{
+    return x[0];
+}
+
+/// The common hand-written hasher: the words combined as in boost::hash_combine().
+template <typename Int>
+[[gnu::noinline]] uint64_t hash_combine(const Int& x) noexcept
+{
+    uint64_t h = 0;
+    for (const auto w : as_words(x))
+        h ^= w + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+    return h;
+}
+
+template <typename Int>
+[[gnu::noinline]] uint64_t hash64(const Int& x) noexcept
+{
+    return intx::hash64(x);
+}
+
+/// Measures the hash throughput over the samples set shifted left by the given number of bits.
+/// The "collisions" counter reports the samples hitting the occupied bucket in a table
+/// of the twice the number of samples, indexed with the low bits of the hash.
+/// For the ideal hash this is ~55.
+template <typename Int, uint64_t HashFn(const Int&) noexcept>
+void hash(benchmark::State& state)
+{
+    const auto set_id = static_cast<samples_set_id>(state.range(0));
+    const auto shift = static_cast<unsigned>(state.range(1));
+    std::array<Int, num_samples> xs;
+    std::ranges::transform(
+        get_samples<Int>(set_id), xs.begin(), [&](auto x) { return x << shift; });
+
+    while (state.KeepRunningBatch(num_samples))
+    {
+        for (const auto& x : xs)
+            benchmark::DoNotOptimize(HashFn(x));
+    }
+
+    std::array<bool, 2 * num_samples> occupied{};
+    int collisions = 0;
+    for (const auto& x : xs)
+    {
+        auto& bucket = occupied[HashFn(x) % occupied.size()];
+        collisions += bucket;
+        bucket = true;
+    }
+    state.counters["collisions"] = collisions;
+}
+#define ARGS Args({x_64, 0})->Args({x_64, 192})->Args({x_256, 0})
+BENCHMARK(hash<uint256, hash_low_word>)->ARGS;
+BENCHMARK(hash<uint256, hash_combine>)->ARGS;
+BENCHMARK(hash<uint256, hash64>)->ARGS;
+#undef ARGS
+#define ARGS Args({x_512, 0})->Args({x_512, 448})
+BENCHMARK(hash<uint512, hash_combine>)->ARGS;
+BENCHMARK(hash<uint512, hash64>)->ARGS;
+#undef ARGS
+
+template <typename Int>
+void std_sort(std::span<Int> keys, unsigned /*num_threads*/)
+{
+    std::sort(keys.begin(), keys.end());
+}
+
+template <typename Int>
+void radix_sort(std::span<Int> keys, unsigned num_threads)
+{
+    intx::radix_sort(keys, num_threads);
+}
+
+/// Sorts the random keys of the given number of significant bits.
+/// The time includes the copy of the unsorted keys.
+template <typename Int, void SortFn(std::span<Int>, unsigned)>
+void sort(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto num_bits = static_cast<unsigned>(state.range(1));
+    const auto num_threads = static_cast<unsigned>(state.range(2));
+
+    lcg<Int> rng{get_seed()};
+    std::vector<Int> input(n);
+    for (auto& x : input)
+        x = rng() >> (Int::num_bits - num_bits);
+
+    std::vector<Int> keys(n);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        keys = input;
+        SortFn(keys, num_threads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+#define ARGS ArgsProduct({{1 << 10, 1 << 16, 1 << 20}, {64, 256}, {1}})->Args({1 << 22, 256, 4})
+BENCHMARK(sort<uint256, std_sort>)->ARGS->UseRealTime();
+BENCHMARK(sort<uint256, radix_sort>)->ARGS->UseRealTime();
+#undef ARGS
+
+enum class search_method
+{
+    std_lower_bound,
+    sorted_index,
+    sorted_index_batch,
+};
+
+/// Looks up the random queries, half of them present, in the set of random keys.
+template <search_method Method>
+void lower_bound(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    lcg<uint256> rng{get_seed()};
+    std::vector<uint256> keys(n);
+    for (auto& k : keys)
+        k = rng();
+    std::vector<uint256> queries(4096);
+    for (size_t i = 0; i < queries.size(); ++i)
+        queries[i] = i % 2 == 0 ? keys[static_cast<size_t>(rng() % n)] : rng();
+
+    const sorted_index<256> index{keys};
+    keys.assign(index.keys().begin(), index.keys().end());
+    std::vector<size_t> out(queries.size());
+
+    while (state.KeepRunningBatch(static_cast<benchmark::IterationCount>(queries.size())))
+    {
+        if constexpr (Method == search_method::sorted_index_batch)
+            index.lower_bound(queries, out);
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            if constexpr (Method == search_method::std_lower_bound)
+                out[i] = static_cast<size_t>(
+                    std::lower_bound(keys.begin(), keys.end(), queries[i]) - keys.begin());
+            else if constexpr (Method == search_method::sorted_index)
+                out[i] = index.lower_bound(queries[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+}
+// The key sets of the L2, L3 and DRAM sizes (32 bytes per key).
+#define ARGS Arg(1 << 14)->Arg(1 << 20)->Arg(1 << 24)
+BENCHMARK(lower_bound<search_method::std_lower_bound>)->ARGS;
+BENCHMARK(lower_bound<search_method::sorted_index>)->ARGS;
+BENCHMARK(lower_bound<search_method::sorted_index_batch>)->ARGS;
+#undef ARGS
 }  // namespace
 
 BENCHMARK_MAIN();
@@ -27,6 +27,45 @@ inline void expect_eq(const T& x, const T& y) noexcept
         __builtin_trap();
 }
 
+/// Cross-checks the x86-64 MULX/ADX kernels against the portable implementations.
+template <typename T>
+inline void check_mulx_adx(const T& a, const T& b) noexcept
+{
+#if INTX_HAS_X86_64_ASM
+    static const bool supported = __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+    if (!supported)
+        return;
+
+    if constexpr (T::num_bits == 256)
+    {
+        uint512 p;
+        internal::x86_64::umul_256(&p[0], &a[0], &b[0]);
+        expect_eq(p, internal::umul_portable(a, b));
+
+        uint256 q;
+        internal::x86_64::mul_256(&q[0], &a[0], &b[0]);
+        expect_eq(q, internal::mul_portable(a, b));
+    }
+    else if constexpr (T::num_bits == 512)
+    {
+        uint512 p;
+        internal::x86_64::mul_512(&p[0], &a[0], &b[0]);
+        expect_eq(p, internal::mul_portable(a, b));
+    }
+
+    auto x = a;
+    auto y = a;
+    const auto multiplier = b[T::num_words - 1];
+    const auto borrow_x = internal::x86_64::submul(&x[0], &b[0], T::num_words, multiplier);
+    const auto borrow_y = internal::submul_portable(&y[0], as_words(b), multiplier);
+    expect_eq(x, y);
+    expect_eq(borrow_x, borrow_y);
+#else
+    (void)a;
+    (void)b;
+#endif
+}
+
 template <typename T>
 inline void test_op(const uint8_t* data, size_t data_size) noexcept
 {
@@ -63,6 +102,8 @@ inline void test_op(const uint8_t* data, size_t data_size) noexcept
         auto x = a * b;
         auto y = gmp::mul(a, b);
         expect_eq(x, y);
+        expect_eq(umul(a, b), gmp::mul_full(a, b));
+        check_mulx_adx(a, b);
         break;
     }
     case op::shl:
@@ -114,6 +155,8 @@ inline void test_op(const uint8_t* data, size_t data_size) noexcept
 
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t data_size) noexcept
 {
+    test_op<intx::uint<16384>>(data, data_size);
+    test_op<intx::uint<8192>>(data, data_size);
     test_op<intx::uint<4096>>(data, data_size);
     test_op<intx::uint<2048>>(data, data_size);
     test_op<intx::uint<1024>>(data, data_size);
@@ -10,11 +10,6 @@
 
 constexpr size_t input_size = 3 * sizeof(intx::uint256);
 
-std::ostream& operator<<(std::ostream& os, const intx::uint256& x)
-{
-    return os << "0x" << to_string(x, 16);
-}
-
 extern "C" size_t LLVMFuzzerMutate(uint8_t* data, size_t size, size_t max_size);
 
 extern "C" size_t LLVMFuzzerCustomMutator(
@@ -54,8 +49,9 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t data_size) noe
 
         if (INTX_UNLIKELY(result != expected))
         {
-            std::cerr << "FAILED: [" << i << "]\n  " << a << " + " << b << " mod " << m
-                      << "\n  result:   " << result << "\n  expected: " << expected << "\n";
+            std::cerr << "FAILED: [" << i << "]\n  " << std::hex << std::showbase << a << " + " << b
+                      << " mod " << m << "\n  result:   " << result << "\n  expected: " << expected
+                      << "\n";
             __builtin_trap();
         }
     }
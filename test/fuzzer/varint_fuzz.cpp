@@ -0,0 +1,91 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <intx/intx.hpp>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+/// The reference LEB128 encoder, one 7-bit group at a time.
+template <unsigned N>
+std::vector<uint8_t> encode_reference(intx::uint<N> x)
+{
+    std::vector<uint8_t> out;
+    do
+    {
+        auto byte = static_cast<uint8_t>(x & 0x7f);
+        x >>= 7;
+        if (x != 0)
+            byte |= 0x80;
+        out.push_back(byte);
+    } while (x != 0);
+    return out;
+}
+
+/// The reference LEB128 decoder with the same error conditions as varint::decode().
+template <unsigned N>
+size_t decode_reference(const uint8_t* data, size_t size, intx::uint<N>& value)
+{
+    intx::uint<N> r;
+    for (size_t i = 0; i < size && i < intx::varint::max_size<N>; ++i)
+    {
+        const auto group = intx::uint<N>{data[i] & 0x7fu};
+        const auto pos = 7 * i;
+        if (pos >= N ? group != 0 : (group << pos) >> pos != group)
+            return 0;
+        r |= group << pos;
+        if ((data[i] & 0x80) == 0)
+        {
+            value = r;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+template <unsigned N>
+void check(const uint8_t* data, size_t data_size)
+{
+    // Round-trip the value taken from the input bytes.
+    intx::uint<N> x;
+    if (data_size != 0)
+    {
+        std::memcpy(&x, data, std::min(data_size, sizeof(x)));
+        x >>= data[0] % N;  // Vary the encoding length.
+    }
+
+    const auto expected = encode_reference(x);
+    uint8_t out[intx::varint::max_size<N>];
+    const auto size = intx::varint::encode(x, out);
+    intx::uint<N> y;
+    const auto consumed = intx::varint::decode({out, size}, y);
+    if (INTX_UNLIKELY(size != expected.size() || std::memcmp(out, expected.data(), size) != 0 ||
+                      consumed != size || y != x))
+    {
+        std::cerr << "FAILED: encode uint" << N << " " << std::hex << std::showbase << x << "\n";
+        __builtin_trap();
+    }
+
+    // Decode the arbitrary input.
+    intx::uint<N> value = 1;
+    intx::uint<N> expected_value = 1;
+    const auto result = intx::varint::decode({data, data_size}, value);
+    const auto expected_result = decode_reference(data, data_size, expected_value);
+    if (INTX_UNLIKELY(result != expected_result || value != expected_value))
+    {
+        std::cerr << "FAILED: decode uint" << N << " " << result << " " << expected_result << "\n";
+        __builtin_trap();
+    }
+}
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t data_size) noexcept
+{
+    check<128>(data, data_size);
+    check<256>(data, data_size);
+    check<512>(data, data_size);
+    return 0;
+}
@@ -0,0 +1,149 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <gtest/gtest.h>
+#include <intx/batch.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+template <typename T>
+class uint_batch_test : public testing::Test
+{};
+
+template <unsigned N, size_t Lanes>
+struct batch_params
+{
+    static constexpr auto bits = N;
+    static constexpr auto lanes = Lanes;
+};
+
+using batch_types = testing::Types<batch_params<128, 4>, batch_params<256, 8>,
+    batch_params<256, 13>, batch_params<512, 16>, batch_params<192, 1>>;
+TYPED_TEST_SUITE(uint_batch_test, batch_types, );
+
+/// Returns the random values including the edge cases.
+template <unsigned N>
+std::vector<intx::uint<N>> values(size_t n)
+{
+    using T = intx::uint<N>;
+    const T edges[] = {0, 1, ~T{0}, ~T{0} - 1, T{1} << (N - 1), T{~uint64_t{0}}, T{1} << 64};
+    test::lcg<T> rng{test::get_seed()};
+    std::vector<T> v(n);
+    for (size_t i = 0; i < n; ++i)
+        v[i] = rng() >> (i % 3 * 37);
+    for (size_t i = 0; i < n; i += 3)
+        v[i] = edges[i / 3 % std::size(edges)];
+    return v;
+}
+}  // namespace
+
+TYPED_TEST(uint_batch_test, gather_scatter)
+{
+    constexpr auto N = TypeParam::bits;
+    constexpr auto L = TypeParam::lanes;
+    using B = uint_batch<N, L>;
+
+    const auto xs = values<N>(L);
+    const auto b = B::gather(xs.data());
+    for (size_t l = 0; l < L; ++l)
+        EXPECT_EQ(b.get(l), xs[l]);
+
+    std::vector<intx::uint<N>> out(L);
+    b.scatter(out.data());
+    EXPECT_EQ(out, xs);
+
+    // Reverse the order with the indexes.
+    std::vector<size_t> indexes(L);
+    for (size_t l = 0; l < L; ++l)
+        indexes[l] = L - 1 - l;
+    const auto r = B::gather(xs.data(), indexes.data());
+    for (size_t l = 0; l < L; ++l)
+        EXPECT_EQ(r.get(l), xs[L - 1 - l]);
+    r.scatter(out.data(), indexes.data());
+    EXPECT_EQ(out, xs);
+
+    auto s = B::broadcast(xs[0]);
+    s.set(L - 1, xs[L - 1]);
+    for (size_t l = 0; l < L - 1; ++l)
+        EXPECT_EQ(s.get(l), xs[0]);
+    EXPECT_EQ(s.get(L - 1), xs[L - 1]);
+}
+
+TYPED_TEST(uint_batch_test, arithmetic)
+{
+    constexpr auto N = TypeParam::bits;
+    constexpr auto L = TypeParam::lanes;
+    using B = uint_batch<N, L>;
+
+    const auto all = values<N>(7 * L);
+    for (size_t k = 0; k + 2 * L <= all.size(); k += L / 2 + 1)
+    {
+        const auto x = B::gather(&all[k]);
+        const auto y = B::gather(&all[k + L]);
+        const auto sum = x + y;
+        const auto diff = x - y;
+        const auto e = cmp_eq(x, y);
+        const auto less = cmp_lt(x, y);
+        const auto less_eq = cmp_le(x, y);
+        for (size_t l = 0; l < L; ++l)
+        {
+            const auto& a = all[k + l];
+            const auto& b = all[k + L + l];
+            EXPECT_EQ(sum.get(l), a + b);
+            EXPECT_EQ(diff.get(l), a - b);
+            EXPECT_EQ((e >> l) & 1, a == b);
+            EXPECT_EQ((less >> l) & 1, a < b);
+            EXPECT_EQ((less_eq >> l) & 1, a <= b);
+        }
+        EXPECT_EQ(cmp_eq(x, x), ~uint64_t{0} >> (64 - L));
+        EXPECT_EQ(cmp_lt(x, x), 0);
+    }
+}
+
+TYPED_TEST(uint_batch_test, bitwise)
+{
+    constexpr auto N = TypeParam::bits;
+    constexpr auto L = TypeParam::lanes;
+    using B = uint_batch<N, L>;
+
+    const auto all = values<N>(2 * L);
+    const auto x = B::gather(&all[0]);
+    const auto y = B::gather(&all[L]);
+    const auto a = x & y;
+    const auto o = x | y;
+    const auto r = x ^ y;
+    const auto n = ~x;
+    for (size_t l = 0; l < L; ++l)
+    {
+        EXPECT_EQ(a.get(l), all[l] & all[L + l]);
+        EXPECT_EQ(o.get(l), all[l] | all[L + l]);
+        EXPECT_EQ(r.get(l), all[l] ^ all[L + l]);
+        EXPECT_EQ(n.get(l), ~all[l]);
+    }
+
+    for (const uint64_t shift : {0u, 1u, 13u, 63u, 64u, 65u, 127u, N - 64, N - 1, N, N + 1})
+    {
+        const auto shl = x << shift;
+        const auto shr = x >> shift;
+        for (size_t l = 0; l < L; ++l)
+        {
+            EXPECT_EQ(shl.get(l), all[l] << shift) << shift;
+            EXPECT_EQ(shr.get(l), all[l] >> shift) << shift;
+        }
+    }
+}
+
+TEST(uint_batch, constexpr_ops)
+{
+    constexpr auto x = uint_batch<256, 4>::broadcast(~uint256{0});
+    constexpr auto y = uint_batch<256, 4>::broadcast(1);
+    static_assert((x + y).get(3) == 0);
+    static_assert((y - x).get(0) == 2);
+    static_assert(cmp_lt(y, x) == 0b1111);
+    static_assert(cmp_eq(x, y) == 0);
+    static_assert((x >> 255).get(1) == 1);
+}
@@ -0,0 +1,168 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/dispatch.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+constexpr dispatch::variant all_variants[] = {dispatch::variant::portable,
+    dispatch::variant::bmi2_adx, dispatch::variant::avx2, dispatch::variant::avx512,
+    dispatch::variant::avx512_ifma};
+
+std::vector<uint256> inputs()
+{
+    std::vector<uint256> v{0, 1, 2, 0xffffffffffffffff, ~uint256{0}, ~uint256{0} - 1,
+        uint256{1} << 255, uint256{1} << 128};
+    test::lcg<uint256> rng{test::get_seed()};
+    for (int i = 0; i < 64; ++i)
+        v.emplace_back(rng() >> (i * 4));
+    return v;
+}
+}  // namespace
+
+TEST(dispatch, detect)
+{
+    const auto v = dispatch::detect();
+    EXPECT_TRUE(dispatch::supported(v));
+    EXPECT_TRUE(dispatch::supported(dispatch::variant::portable));
+
+    const auto& t = dispatch::kernels();
+    EXPECT_LE(t.arithmetic, v);
+    EXPECT_LE(t.bytes, v);
+    EXPECT_LE(t.batch, v);
+    EXPECT_EQ(&t, &dispatch::kernels());
+
+    EXPECT_STREQ(dispatch::to_string(dispatch::variant::portable), "portable");
+    EXPECT_STREQ(dispatch::to_string(dispatch::variant::avx512), "avx512");
+    EXPECT_STREQ(dispatch::to_string(dispatch::variant::avx512_ifma), "avx512_ifma");
+}
+
+TEST(dispatch, arithmetic)
+{
+    const auto xs = inputs();
+    for (const auto v : all_variants)
+    {
+        if (!dispatch::supported(v))
+            continue;
+
+        const auto t = dispatch::make_kernel_table(v);
+        for (const auto& x : xs)
+        {
+            for (const auto& y : xs)
+            {
+                ASSERT_EQ(t.umul(x, y), umul(x, y)) << dispatch::to_string(v);
+                if (y == 0)
+                    continue;
+                ASSERT_EQ(t.udivrem(x, y), udivrem(x, y)) << dispatch::to_string(v);
+                ASSERT_EQ(t.mulmod(x, x, y), mulmod(x, x, y)) << dispatch::to_string(v);
+                ASSERT_EQ(t.addmod(x, x, y), addmod(x, x, y)) << dispatch::to_string(v);
+            }
+        }
+    }
+
+    EXPECT_EQ(dispatch::umul(xs[9], xs[10]), umul(xs[9], xs[10]));
+    EXPECT_EQ(dispatch::udivrem(xs[9], xs[10]), udivrem(xs[9], xs[10]));
+    EXPECT_EQ(dispatch::mulmod(xs[9], xs[10], xs[11]), mulmod(xs[9], xs[10], xs[11]));
+    EXPECT_EQ(dispatch::addmod(xs[9], xs[10], xs[11]), addmod(xs[9], xs[10], xs[11]));
+}
+
+TEST(dispatch, bswap)
+{
+    const auto xs = inputs();
+    for (const auto v : all_variants)
+    {
+        if (!dispatch::supported(v))
+            continue;
+
+        const auto t = dispatch::make_kernel_table(v);
+        for (size_t n = 0; n <= 9; ++n)
+        {
+            std::vector<uint256> values(xs.begin(), xs.begin() + static_cast<ptrdiff_t>(n));
+            t.bswap(values.data(), values.size());
+            for (size_t i = 0; i < n; ++i)
+                ASSERT_EQ(values[i], bswap(xs[i])) << dispatch::to_string(v) << " " << n;
+        }
+    }
+
+    auto values = xs;
+    dispatch::bswap(values);
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(values[i], bswap(xs[i]));
+}
+
+TEST(dispatch, hex_encode)
+{
+    std::vector<uint8_t> data(200);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<uint8_t>(i * 37 + 11);
+
+    std::string expected;
+    for (const auto b : data)
+    {
+        expected.push_back("0123456789abcdef"[b >> 4]);
+        expected.push_back("0123456789abcdef"[b & 0xf]);
+    }
+
+    for (const auto v : all_variants)
+    {
+        if (!dispatch::supported(v))
+            continue;
+
+        const auto t = dispatch::make_kernel_table(v);
+        for (size_t n = 0; n <= data.size(); n += (n < 70 ? 1 : 13))
+        {
+            std::string out(2 * n + 1, '_');
+            const auto end = t.hex_encode(out.data(), data.data(), n);
+            ASSERT_EQ(end, &out[2 * n]) << dispatch::to_string(v) << " " << n;
+            EXPECT_EQ(out.back(), '_');
+            out.pop_back();
+            ASSERT_EQ(out, expected.substr(0, 2 * n)) << dispatch::to_string(v) << " " << n;
+        }
+    }
+
+    std::string out(2 * data.size(), '_');
+    dispatch::hex_encode(out.data(), data);
+    EXPECT_EQ(out, expected);
+}
+
+TEST(dispatch, mulmod_batch)
+{
+    const auto xs = inputs();
+    std::vector<uint256> ys(xs.rbegin(), xs.rend());
+    const uint256 secp256k1_p =
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    const uint256 moduli[] = {1, 3, 0xfffffffffffffffe, secp256k1_p, ~uint256{0}, xs[9] | 1,
+        xs[30] | 1, xs[40] | 1, xs[41], uint256{1} << 255};
+
+    for (const auto v : all_variants)
+    {
+        if (!dispatch::supported(v))
+            continue;
+
+        const auto t = dispatch::make_kernel_table(v);
+        for (const auto& mod : moduli)
+        {
+            for (size_t n = 0; n <= xs.size(); n += (n < 20 ? 1 : 17))
+            {
+                std::vector<uint256> out(n);
+                t.mulmod_batch(xs.data(), ys.data(), n, mod, out.data());
+                for (size_t i = 0; i < n; ++i)
+                {
+                    ASSERT_EQ(out[i], mulmod(xs[i], ys[i], mod))
+                        << dispatch::to_string(v) << " " << hex(mod) << " " << n << " " << i;
+                }
+            }
+        }
+    }
+
+    // In place.
+    auto values = xs;
+    dispatch::mulmod_batch(values, ys, secp256k1_p, values);
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(values[i], mulmod(xs[i], ys[i], secp256k1_p));
+}
@@ -5,6 +5,7 @@
 #include <experimental/div.hpp>
 #include <gtest/gtest.h>
 #include <intx/intx.hpp>
+#include <test/utils/random.hpp>
 
 using namespace intx;
 
@@ -397,6 +398,47 @@ TEST(div, udivrem_512_by_256)
     }
 }
 
+template <unsigned M, unsigned N>
+static void check_udivrem_wide()
+{
+    std::mt19937_64 gen{test::get_seed()};
+    const auto rng = [&gen] {
+        intx::uint<M> x;
+        std::ranges::generate(as_words(x), std::ref(gen));
+        return x;
+    };
+    const auto ones = ~intx::uint<M>{0};
+
+    for (unsigned divisor_bits : {N / 2, N * 3 / 4 + 1, N - 65, N - 64, N - 1, N})
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            auto y = static_cast<intx::uint<N>>(rng()) >> (N - divisor_bits);
+            if (i % 4 == 1)
+                y = ~intx::uint<N>{0} >> (N - divisor_bits);  // All ones.
+            y |= intx::uint<N>{1} << (divisor_bits - 1);
+
+            // The numerator top words equal to the divisor's hit the maximal quotient estimate.
+            auto x = i % 4 == 2 ? ones : rng();
+            if (i % 4 == 3)
+                x = (intx::uint<M>{y} << (M - divisor_bits)) | (rng() >> divisor_bits);
+
+            const auto [q, r] = udivrem(x, y);
+            EXPECT_LT(r, y);
+            EXPECT_EQ(umul(q, intx::uint<M>{y}) + intx::uint<2 * M>{r}, intx::uint<2 * M>{x});
+        }
+    }
+}
+
+TEST(div, udivrem_wide)
+{
+    check_udivrem_wide<4096, 2048>();
+    check_udivrem_wide<4096, 4096>();
+    check_udivrem_wide<8192, 4096>();
+    check_udivrem_wide<8192, 1024>();
+    check_udivrem_wide<16384, 8192>();
+}
+
 
 constexpr div_test_case<uint256> sdivrem_test_cases[] = {
     {13_u256, 3_u256, 4_u256, 1_u256},
@@ -489,3 +531,146 @@ TEST(div, by128)
     const auto y = uint128{2};
     EXPECT_EQ(udivrem(x, y).rem, 1);
 }
+
+TEST(div, divider)
+{
+    for (auto& t : div_test_cases)
+    {
+        const divider<512> d{t.denominator};
+        EXPECT_EQ(d.divisor(), t.denominator);
+        const auto [quot, rem] = d.divrem(t.numerator);
+        EXPECT_EQ(quot, t.quotient);
+        EXPECT_EQ(rem, t.reminder);
+        EXPECT_EQ(d.quot(t.numerator), t.quotient);
+        EXPECT_EQ(d.rem(t.numerator), t.reminder);
+
+        const auto d256 = static_cast<uint256>(t.denominator);
+        if (d256 != t.denominator)
+            continue;  // Skip trimmed divisors.
+
+        const divider<256> d2{d256};
+        EXPECT_EQ(d2.quot(t.numerator), t.quotient);
+        EXPECT_EQ(d2.rem(t.numerator), static_cast<uint256>(t.reminder));
+    }
+}
+
+TEST(div, divider_mixed_sizes)
+{
+    test::lcg<uint512> rng{test::get_seed()};
+    for (unsigned divisor_bits : {1u, 7u, 64u, 65u, 127u, 128u, 150u, 192u, 255u, 256u})
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            auto y = static_cast<uint256>(rng()) >> (256 - divisor_bits);
+            y |= uint256{1} << (divisor_bits - 1);
+            const divider<256> d{y};
+
+            const auto x = rng();
+            EXPECT_EQ(d.divrem(x), udivrem(x, y));
+
+            const auto x128 = static_cast<uint128>(x);
+            EXPECT_EQ(d.divrem(x128), udivrem(x128, y));
+
+            const auto x256 = static_cast<uint256>(x);
+            EXPECT_EQ(d.divrem(x256), udivrem(x256, y));
+        }
+    }
+
+    static_assert(divider<128>{10}.divrem(123_u256) == div_result<uint256, uint128>{12, 3});
+}
+
+TEST(div, udivrem_const)
+{
+    static_assert(udivrem_const<10>(1234_u256) == div_result<uint256>{123, 4});
+    static_assert(udivrem_const<1>(1234_u256) == div_result<uint256>{1234, 0});
+    static_assert(constant_divider<256>{1_u256 << 64}.divrem(~0_u256).rem == ~uint64_t{0});
+
+    constexpr auto e18 = uint64_t{1000000000000000000};
+    constexpr auto p64 = ~uint64_t{0} - 58;
+    constexpr constant_divider<256> e38{100000000000000000000000000000000000000_u256};
+    constexpr constant_divider<256> p192{0xfffffffffffffffffffffffffffffffeffffffffffffffff_u256};
+    constexpr constant_divider<256> max{~0_u256};
+    constexpr constant_divider<256> top{1_u256 << 255};
+    constexpr constant_divider<512> big{(1_u512 << 400) + 0x1234567};
+    static_assert(e38.divisor() == 100000000000000000000000000000000000000_u256);
+
+    test::lcg<uint512> rng{test::get_seed()};
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto x512 = rng() >> (i % 500);
+        const auto x = static_cast<uint256>(x512);
+        EXPECT_EQ(udivrem_const<e18>(x), udivrem(x, uint256{e18}));
+        EXPECT_EQ(udivrem_const<1000000000>(x), udivrem(x, uint256{1000000000}));
+        EXPECT_EQ(udivrem_const<p64>(x), udivrem(x, uint256{p64}));
+        EXPECT_EQ(udivrem_const<7>(x512), udivrem(x512, uint512{7}));
+        EXPECT_EQ(udivrem_const<e18>(static_cast<uint128>(x)),
+            udivrem(static_cast<uint128>(x), uint128{e18}));
+
+        EXPECT_EQ(e38.divrem(x), udivrem(x, e38.divisor()));
+        EXPECT_EQ(p192.divrem(x), udivrem(x, p192.divisor()));
+        EXPECT_EQ(max.divrem(x), udivrem(x, max.divisor()));
+        EXPECT_EQ(top.divrem(x), udivrem(x, top.divisor()));
+        EXPECT_EQ(big.divrem(x512), udivrem(x512, big.divisor()));
+    }
+
+    for (const auto x : {0_u256, 1_u256, ~0_u256, e38.divisor(), e38.divisor() - 1, max.divisor()})
+    {
+        EXPECT_EQ(e38.divrem(x), udivrem(x, e38.divisor()));
+        EXPECT_EQ(max.divrem(x), udivrem(x, max.divisor()));
+        EXPECT_EQ(udivrem_const<p64>(x), udivrem(x, uint256{p64}));
+    }
+}
+
+namespace
+{
+/// Checks muldiv() against the division of the product.
+template <unsigned N>
+void check_muldiv(const intx::uint<N>& a, const intx::uint<N>& b, const intx::uint<N>& c)
+{
+    const auto floor = muldiv(a, b, c);
+    const auto ceil = muldiv(a, b, c, rounding::ceil);
+    if (c == 0)
+    {
+        EXPECT_TRUE(floor.carry);
+        EXPECT_TRUE(ceil.carry);
+        return;
+    }
+
+    const auto [q, r] = udivrem(umul(a, b), intx::uint<2 * N>{c});
+    const auto q_ceil = r != 0 ? q + 1 : q;
+    const auto max = intx::uint<2 * N>{~intx::uint<N>{0}};
+    EXPECT_EQ(floor.carry, q > max) << hex(a) << " " << hex(b) << " " << hex(c);
+    EXPECT_EQ(ceil.carry, q_ceil > max) << hex(a) << " " << hex(b) << " " << hex(c);
+    EXPECT_EQ(floor.value, q <= max ? static_cast<intx::uint<N>>(q) : 0);
+    EXPECT_EQ(ceil.value, q_ceil <= max ? static_cast<intx::uint<N>>(q_ceil) : 0);
+}
+}  // namespace
+
+TEST(div, muldiv)
+{
+    static_assert(muldiv(10_u256, 10_u256, 3_u256).value == 33);
+    static_assert(muldiv(10_u256, 10_u256, 3_u256, rounding::ceil).value == 34);
+    static_assert(muldiv(~0_u256, ~0_u256, ~0_u256).value == ~0_u256);
+    static_assert(muldiv(~0_u256, 2_u256, 1_u256).carry);
+    static_assert(muldiv(1_u256, 1_u256, 0_u256).carry);
+
+    const auto max = ~0_u256;
+    for (const auto& [a, b, c] : {std::array{max, max, max}, {max, max, max - 1}, {max, 1, 1},
+             {max, 2, 2}, {max, max - 1, max}, {0, 0, 1}, {0, max, 5}, {1, 1, 2},
+             {max, max, 1_u256 << 255}, {max, 3, 2}, {1_u256 << 200, 1_u256 << 100, 1}})
+    {
+        check_muldiv(a, b, c);
+    }
+
+    test::lcg<uint256> rng{test::get_seed()};
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto a = rng() >> (i % 7 * 37);
+        const auto b = rng() >> (i % 5 * 53);
+        const auto c = rng() >> (i % 11 * 23);
+        check_muldiv(a, b, c);
+        check_muldiv(a, b, c | 1);
+        check_muldiv(static_cast<uint128>(a), static_cast<uint128>(b), static_cast<uint128>(c));
+        check_muldiv(uint512{a} << 100, uint512{b}, uint512{c});
+    }
+}
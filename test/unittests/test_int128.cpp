@@ -423,9 +423,25 @@ TEST(int128, from_string_exceptions)
     EXPECT_THROW_MESSAGE(from_string<uint128>("0x100000000000000000000000000000000"),
         std::out_of_range, "0x100000000000000000000000000000000");
 
+    // The leading zeros count towards the max number of digits, as opposed to from_chars().
+    EXPECT_EQ(from_string<uint128>("000000000000000000000000000000000000001"), 1);
+    EXPECT_THROW_MESSAGE(from_string<uint128>("0000000000000000000000000000000000000001"),
+        std::out_of_range, "0000000000000000000000000000000000000001");
+    EXPECT_EQ(from_string<uint128>("0x00000000000000000000000000000001"), 1);
+    EXPECT_THROW_MESSAGE(from_string<uint128>("0x000000000000000000000000000000001"),
+        std::out_of_range, "0x000000000000000000000000000000001");
+
     EXPECT_THROW_MESSAGE(from_string<uint128>("123a"), std::invalid_argument, "invalid digit");
     EXPECT_THROW_MESSAGE(from_string<uint128>("0xcdefg"), std::invalid_argument, "invalid digit");
 
+    // The invalid digits are reported before the too many digits.
+    EXPECT_THROW_MESSAGE(from_string<uint128>("z0000000000000000000000000000000000000001"),
+        std::invalid_argument, "invalid digit");
+    EXPECT_THROW_MESSAGE(from_string<uint128>("0000000000000000000000000000000000000001z"),
+        std::invalid_argument, "invalid digit");
+    EXPECT_THROW_MESSAGE(from_string<uint128>("0xz000000000000000000000000000000001"),
+        std::invalid_argument, "invalid digit");
+
     // TODO: Binary literals 0xb... are not supported yet.
     EXPECT_THROW_MESSAGE(from_string<uint128>("0b1"), std::invalid_argument, "invalid digit");
     EXPECT_THROW_MESSAGE(from_string<uint128>("0b1010"), std::invalid_argument, "invalid digit");
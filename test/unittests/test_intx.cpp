@@ -3,6 +3,11 @@
 // Licensed under the Apache License, Version 2.0.
 
 #include "test_suite.hpp"
+#include <test/utils/random.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <unordered_set>
 
 using namespace intx;
 
@@ -285,6 +290,108 @@ struct storage
     uint8_t bytes[M];
 };
 
+TYPED_TEST(uint_test, be_minimal)
+{
+    constexpr auto size = sizeof(TypeParam);
+    for (size_t k = 0; k <= size; ++k)
+    {
+        // The value with exactly k significant bytes.
+        TypeParam x;
+        for (size_t i = 0; i < k; ++i)
+            x = (x << 8) | (0x81 + i);
+
+        uint8_t full[size];
+        be::store(full, x);
+
+        uint8_t out[size + 2];
+        std::fill(std::begin(out), std::end(out), uint8_t{0xcc});
+        ASSERT_EQ(be::store_minimal(out, x), k);
+        EXPECT_EQ(std::memcmp(out, &full[size - k], k), 0) << k;
+        EXPECT_EQ(out[k], 0xcc) << k;
+
+        const auto y = be::load_minimal<TypeParam>(std::span{out, k});
+        ASSERT_TRUE(y.has_value()) << k;
+        EXPECT_EQ(*y, x) << k;
+
+        // The leading zero byte is rejected.
+        const auto z = std::span{full}.subspan(size - k - (k < size ? 1 : 0));
+        EXPECT_EQ(be::load_minimal<TypeParam>(z).has_value(), k == size) << k;
+    }
+
+    uint8_t overlong[size + 1]{1};
+    EXPECT_FALSE(be::load_minimal<TypeParam>(overlong).has_value());
+    EXPECT_EQ(be::load_minimal<TypeParam>({}), TypeParam{0});
+    uint8_t zero_out[1]{0xcc};
+    EXPECT_EQ(be::store_minimal(zero_out, TypeParam{0}), 0);
+    EXPECT_EQ(zero_out[0], 0xcc);
+}
+
+TYPED_TEST(uint_test, varint)
+{
+    constexpr auto max_size = varint::max_size<TypeParam::num_bits>;
+    const auto reference = [](TypeParam x) {
+        std::vector<uint8_t> out;
+        do
+        {
+            auto b = static_cast<uint8_t>(x[0] & 0x7f);
+            x >>= 7;
+            if (x != 0)
+                b |= 0x80;
+            out.push_back(b);
+        } while (x != 0);
+        return out;
+    };
+
+    std::vector<TypeParam> values{0, 1, 0x7f, 0x80, 0x3fff, 0x4000, ~TypeParam{0}};
+    test::lcg<TypeParam> rng{test::get_seed()};
+    for (unsigned i = 0; i < TypeParam::num_bits; ++i)
+    {
+        values.emplace_back(TypeParam{1} << i);
+        values.emplace_back((TypeParam{1} << i) - 1);
+        values.emplace_back(rng() >> i);
+    }
+
+    for (const auto& x : values)
+    {
+        const auto expected = reference(x);
+        uint8_t buffer[max_size + 8];
+        std::fill(std::begin(buffer), std::end(buffer), uint8_t{0xcc});
+        const auto size = varint::encode(x, buffer);
+        ASSERT_EQ(std::vector(buffer, buffer + size), expected) << hex(x);
+        EXPECT_LE(size, max_size);
+        EXPECT_EQ(buffer[size], 0xcc);
+
+        // Decode from the exact input (the tail path) and with padding (the word path).
+        TypeParam y;
+        EXPECT_EQ(varint::decode(std::span{buffer, size}, y), size) << hex(x);
+        EXPECT_EQ(y, x);
+        y = 0;
+        EXPECT_EQ(varint::decode(buffer, y), size) << hex(x);
+        EXPECT_EQ(y, x);
+
+        // Truncated.
+        EXPECT_EQ(varint::decode(std::span{buffer, size - 1}, y), 0);
+    }
+
+    TypeParam y = 1;
+    // The value above N bits.
+    std::vector<uint8_t> overflow(max_size, 0xff);
+    overflow.back() = 0x7f;
+    EXPECT_EQ(varint::decode(overflow, y), 0);
+    overflow.back() = static_cast<uint8_t>(0x7f >> (7 * max_size - TypeParam::num_bits));
+    EXPECT_EQ(varint::decode(overflow, y), max_size);
+    EXPECT_EQ(y, ~TypeParam{0});
+
+    // Too long, even if the value fits.
+    std::vector<uint8_t> overlong(max_size + 1, 0x80);
+    overlong.back() = 0;
+    EXPECT_EQ(varint::decode(overlong, y), 0);
+    overlong.resize(overlong.size() + 8, 0);
+    EXPECT_EQ(varint::decode(overlong, y), 0);
+    EXPECT_EQ(varint::decode({}, y), 0);
+    EXPECT_EQ(y, ~TypeParam{0});
+}
+
 TYPED_TEST(uint_test, typed_store)
 {
     const auto x = TypeParam{2};
@@ -317,6 +424,34 @@ TYPED_TEST(uint_test, typed_load)
 }
 
 
+TYPED_TEST(uint_test, load_store_n)
+{
+    constexpr auto size = sizeof(TypeParam);
+    for (const size_t n : {0u, 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 17u})
+    {
+        std::vector<uint8_t> bytes(n * size);
+        for (size_t i = 0; i < bytes.size(); ++i)
+            bytes[i] = static_cast<uint8_t>(i * 7 + 1);
+
+        std::vector<TypeParam> values(n);
+        be::load_n(bytes, std::span{values});
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_EQ(values[i], be::unsafe::load<TypeParam>(&bytes[i * size])) << n << " " << i;
+
+        std::vector<uint8_t> out(bytes.size());
+        be::store_n(out, std::span<const TypeParam>{values});
+        EXPECT_EQ(out, bytes) << n;
+
+        le::load_n(bytes, std::span{values});
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_EQ(values[i], le::unsafe::load<TypeParam>(&bytes[i * size])) << n << " " << i;
+
+        std::fill(out.begin(), out.end(), uint8_t{0});
+        le::store_n<TypeParam::num_bits>(out, values);
+        EXPECT_EQ(out, bytes) << n;
+    }
+}
+
 TYPED_TEST(uint_test, convert_to_bool)
 {
     constexpr auto half_bits_count = sizeof(TypeParam) * 4;
@@ -360,6 +495,265 @@ TYPED_TEST(uint_test, to_string_base)
     EXPECT_EQ(to_string(x, 8), "2000");
 }
 
+TYPED_TEST(uint_test, to_chars)
+{
+    // The reference conversion producing one digit at a time.
+    const auto to_string_naive = [](TypeParam x, int base) {
+        std::string s;
+        do
+        {
+            const auto [q, r] = udivrem(x, TypeParam{base});
+            s.insert(s.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[static_cast<int>(r)]);
+            x = q;
+        } while (x != 0);
+        return s;
+    };
+
+    test::lcg<TypeParam> rng{test::get_seed()};
+    std::vector<TypeParam> values{0, 1, 9, 10, 99, 100, TypeParam{10000000000000000000u},
+        TypeParam{10000000000000000000u} - 1, ~TypeParam{0}, TypeParam{1} << 64};
+    for (unsigned i = 0; i < 50; ++i)
+        values.emplace_back(rng() >> (i * 7 % sizeof(TypeParam) * 8));
+
+    char buffer[sizeof(TypeParam) * 8 + 1];
+    for (int base = 2; base <= 36; ++base)
+    {
+        for (const auto& x : values)
+        {
+            const auto expected = to_string_naive(x, base);
+            const auto r = to_chars(std::begin(buffer), std::end(buffer), x, base);
+            ASSERT_EQ(r.ec, std::errc{});
+            ASSERT_EQ(std::string(buffer, r.ptr), expected) << base;
+            EXPECT_EQ(to_string(x, base), expected);
+
+            const auto too_small = to_chars(buffer, buffer + expected.size() - 1, x, base);
+            EXPECT_EQ(too_small.ec, std::errc::value_too_large);
+            EXPECT_EQ(too_small.ptr, buffer + expected.size() - 1);
+        }
+    }
+}
+
+TYPED_TEST(uint_test, from_chars)
+{
+    test::lcg<TypeParam> rng{test::get_seed()};
+    std::vector<TypeParam> values{0, 1, 9, 10, 15, 16, TypeParam{10000000000000000000u},
+        TypeParam{10000000000000000000u} - 1, ~TypeParam{0}, TypeParam{1} << 64};
+    for (unsigned i = 0; i < 50; ++i)
+        values.emplace_back(rng() >> (i * 7 % sizeof(TypeParam) * 8));
+
+    for (int base = 2; base <= 36; ++base)
+    {
+        for (const auto& x : values)
+        {
+            // Add the leading zeros and the trailing non-digit.
+            const auto s = "000" + to_string(x, base) + "#";
+            TypeParam y;
+            const auto r = from_chars(s.data(), s.data() + s.size(), y, base);
+            ASSERT_EQ(r.ec, std::errc{});
+            EXPECT_EQ(r.ptr, &s.back());
+            EXPECT_EQ(y, x) << base << " " << s;
+        }
+    }
+
+    const std::string max_hex(sizeof(TypeParam) * 2, 'F');
+    TypeParam x = 1;
+    EXPECT_EQ(from_chars(max_hex.data(), max_hex.data() + max_hex.size(), x, 16).ec, std::errc{});
+    EXPECT_EQ(x, ~TypeParam{0});
+
+    // Out of range: the ptr is past the digits and the value is not modified.
+    for (const auto& [str, base] : std::initializer_list<std::pair<std::string, int>>{
+             {"1" + std::string(sizeof(TypeParam) * 2, '0'), 16},
+             {to_string(~TypeParam{0}) + "0", 10},
+             {"1" + std::string(sizeof(TypeParam) * 8, '0'), 2},
+             {std::string(sizeof(TypeParam) * 2, 'z'), 36}})
+    {
+        x = 7;
+        const auto s = str + "#";
+        const auto r = from_chars(s.data(), s.data() + s.size(), x, base);
+        EXPECT_EQ(r.ec, std::errc::result_out_of_range) << s;
+        EXPECT_EQ(r.ptr, &s.back());
+        EXPECT_EQ(x, 7);
+    }
+
+    // No digits.
+    for (const std::string s : {"", "x", "-1", "+1", " 1"})
+    {
+        x = 7;
+        const auto r = from_chars(s.data(), s.data() + s.size(), x, 16);
+        EXPECT_EQ(r.ec, std::errc::invalid_argument);
+        EXPECT_EQ(r.ptr, s.data());
+        EXPECT_EQ(x, 7);
+    }
+
+    // The hex digits scan stops at the first non-digit in any position.
+    const std::string hex_digits = "0123456789abcdefABCDEF0123456789abcdef";
+    for (size_t i = 0; i < hex_digits.size(); ++i)
+    {
+        for (const char c : {'g', 'G', '/', ':', '@', '`', '\0', '\xff'})
+        {
+            auto s = hex_digits;
+            s[i] = c;
+            const auto r = from_chars(s.data(), s.data() + s.size(), x, 16);
+            EXPECT_EQ(r.ptr, s.data() + i);
+        }
+    }
+}
+
+TYPED_TEST(uint_test, hex_chars)
+{
+    test::lcg<TypeParam> rng{test::get_seed()};
+    std::vector<TypeParam> values{0, 1, 0xf, 0x10, 0xff, 0x100, ~TypeParam{0}, TypeParam{1} << 64};
+    for (unsigned i = 0; i < 50; ++i)
+        values.emplace_back(rng() >> (i * 5 % sizeof(TypeParam) * 8));
+
+    char buffer[sizeof(TypeParam) * 2 + 2];
+    std::string expected_batch;
+    for (const auto& x : values)
+    {
+        const auto expected = "0x" + hex(x);
+        const auto r = to_hex_chars(std::begin(buffer), std::end(buffer), x);
+        ASSERT_EQ(r.ec, std::errc{});
+        EXPECT_EQ(std::string(buffer, r.ptr), expected);
+
+        const auto too_small = to_hex_chars(buffer, buffer + expected.size() - 1, x);
+        EXPECT_EQ(too_small.ec, std::errc::value_too_large);
+
+        TypeParam y;
+        const auto p = from_hex_chars(expected.data(), expected.data() + expected.size(), y);
+        ASSERT_EQ(p.ec, std::errc{});
+        EXPECT_EQ(p.ptr, expected.data() + expected.size());
+        EXPECT_EQ(y, x);
+
+        if (!expected_batch.empty())
+            expected_batch += "\",\"";
+        expected_batch += expected;
+    }
+
+    std::string out(expected_batch.size(), '_');
+    const auto r = to_hex_chars(
+        out.data(), out.data() + out.size(), std::span<const TypeParam>{values}, "\",\"");
+    EXPECT_EQ(r.ec, std::errc{});
+    EXPECT_EQ(r.ptr, out.data() + out.size());
+    EXPECT_EQ(out, expected_batch);
+    EXPECT_EQ(to_hex_chars(out.data(), out.data() + out.size() - 1,
+                  std::span<const TypeParam>{values}, "\",\"")
+                  .ec,
+        std::errc::value_too_large);
+}
+
+TEST(uint256, from_hex_chars)
+{
+    uint256 x;
+    for (const std::string s : {"0xFf", "0XfF", "ff", "0x00ff"})
+    {
+        const auto r = from_hex_chars(s.data(), s.data() + s.size(), x);
+        EXPECT_EQ(r.ec, std::errc{});
+        EXPECT_EQ(r.ptr, s.data() + s.size());
+        EXPECT_EQ(x, 0xff);
+    }
+
+    for (const std::string invalid : {"0xg", "0x", "0X", "0x#"})
+    {
+        x = 7;
+        const auto r = from_hex_chars(invalid.data(), invalid.data() + invalid.size(), x);
+        EXPECT_EQ(r.ec, std::errc::invalid_argument) << invalid;
+        EXPECT_EQ(r.ptr, invalid.data());
+        EXPECT_EQ(x, 7);
+    }
+    const std::string too_big = "0x1" + std::string(64, '0');
+    EXPECT_EQ(from_hex_chars(too_big.data(), too_big.data() + too_big.size(), x).ec,
+        std::errc::result_out_of_range);
+}
+
+TEST(uint256, to_chars_constexpr)
+{
+    constexpr auto s = [] {
+        std::array<char, 80> buffer{};
+        to_chars(buffer.data(), buffer.data() + buffer.size(), ~0_u256);
+        return buffer;
+    }();
+    static_assert(s[0] == '1' && s[77] == '5' && s[78] == '\0');
+}
+
+TYPED_TEST(uint_test, ostream)
+{
+    const auto x = (TypeParam{1} << (TypeParam::num_bits - 1)) | 0xabc;
+    std::ostringstream os;
+    os << x;
+    EXPECT_EQ(os.str(), to_string(x));
+
+    os.str({});
+    os << std::hex << x << ' ' << std::showbase << std::uppercase << x << ' ' << TypeParam{0};
+    EXPECT_EQ(os.str(), hex(x) + " 0X8" + std::string(TypeParam::num_bits / 4 - 4, '0') + "ABC 0");
+
+    os.str({});
+    os << std::oct << std::nouppercase << TypeParam{8} << std::noshowbase << ' ' << TypeParam{8};
+    EXPECT_EQ(os.str(), "010 10");
+
+    os.str({});
+    os << std::dec << std::setw(6) << std::setfill('*') << TypeParam{42} << std::left
+       << std::setw(4) << TypeParam{7} << '|';
+    EXPECT_EQ(os.str(), "****427***|");
+}
+
+TEST(uint256, format_spec)
+{
+    const auto format = [](std::string_view fmt, const uint256& x) {
+        internal::format_spec spec;
+        const auto p = spec.parse(fmt.data(), fmt.data() + fmt.size());
+        if (p == nullptr)
+            return std::string{"error"};
+        EXPECT_EQ(p, fmt.data() + fmt.size());
+        std::string s;
+        internal::format_to(std::back_inserter(s), x, spec);
+        return s;
+    };
+
+    EXPECT_EQ(format("", 0), "0");
+    EXPECT_EQ(format("d", ~0_u256), to_string(~0_u256));
+    EXPECT_EQ(format("x", 0xbeef), "beef");
+    EXPECT_EQ(format("#x", 0xbeef), "0xbeef");
+    EXPECT_EQ(format("#X", 0xbeef), "0XBEEF");
+    EXPECT_EQ(format("b", 5), "101");
+    EXPECT_EQ(format("#B", 5), "0B101");
+    EXPECT_EQ(format("#o", 8), "010");
+    EXPECT_EQ(format("#o", 0), "0");
+    EXPECT_EQ(format("b", ~0_u256), std::string(256, '1'));
+    EXPECT_EQ(format("#b", ~0_u256), "0b" + std::string(256, '1'));
+    EXPECT_EQ(format("8", 42), "      42");
+    EXPECT_EQ(format("<8", 42), "42      ");
+    EXPECT_EQ(format("*^7", 42), "**42***");
+    EXPECT_EQ(format("#010x", 0xff), "0x000000ff");
+    EXPECT_EQ(format(">#010x", 0xff), "      0xff");
+    EXPECT_EQ(format("_>3", 12345), "12345");
+    EXPECT_EQ(format("e", 1), "error");
+    EXPECT_EQ(format("5.2", 1), "error");
+    EXPECT_EQ(format("99999999", 1), "error");
+
+    // The parsing stops at the closing brace.
+    internal::format_spec spec;
+    const std::string_view fmt = "#x}rest";
+    EXPECT_EQ(spec.parse(fmt.data(), fmt.data() + fmt.size()), &fmt[2]);
+
+    static_assert([] {
+        char buffer[8]{};
+        internal::format_spec s;
+        s.parse(std::begin("04}"), std::end("04}"));
+        internal::format_to(buffer, 7_u256, s);
+        return buffer[0] == '0' && buffer[3] == '7';
+    }());
+}
+
+#ifdef __cpp_lib_format
+TEST(uint256, std_format)
+{
+    EXPECT_EQ(std::format("{}", 42_u256), "42");
+    EXPECT_EQ(std::format("{:#x}|{:X}|{:b}", 255_u256, 255_u256, 5_u256), "0xff|FF|101");
+    EXPECT_EQ(std::format("{:*>6}|{:<4}|{:06}", 42_u256, 7_u256, 9_u256), "****42|7   |000009");
+    EXPECT_EQ(std::format("{}", ~0_u512), to_string(~0_u512));
+}
+#endif
+
 TYPED_TEST(uint_test, as_bytes)
 {
     constexpr auto x = to_little_endian(TypeParam{0xa05});
@@ -374,3 +768,118 @@ TYPED_TEST(uint_test, as_bytes)
     y = to_little_endian(y);
     EXPECT_EQ(y, 0xc03);
 }
+
+static_assert(hash64(uint256{}) == hash128(uint256{})[0]);
+static_assert(hash64(uint256{1}) != hash64(uint256{1}, 1));
+
+TYPED_TEST(uint_test, hash)
+{
+    // The zero and all the single-bit values.
+    std::vector<TypeParam> values{0};
+    for (unsigned i = 0; i < TypeParam::num_bits; ++i)
+        values.emplace_back(TypeParam{1} << i);
+
+    std::unordered_set<uint64_t> lo;
+    std::unordered_set<uint64_t> hi;
+    std::unordered_set<uint64_t> seeded;
+    std::unordered_set<uint64_t> buckets;
+    for (const auto& x : values)
+    {
+        const auto h = hash128(x);
+        EXPECT_EQ(hash64(x), h[0]);
+        EXPECT_EQ(std::hash<TypeParam>{}(x), h[0]);
+        EXPECT_NE(hash64(x, 1), h[0]);
+        lo.insert(h[0]);
+        hi.insert(h[1]);
+        seeded.insert(hash64(x, 0xc0ffee));
+        buckets.insert(h[0] & 0xff);
+    }
+    EXPECT_EQ(lo.size(), values.size());
+    EXPECT_EQ(hi.size(), values.size());
+    EXPECT_EQ(seeded.size(), values.size());
+    EXPECT_GT(buckets.size(), std::min(values.size(), size_t{256}) / 2);
+
+    // The values differing only in the swapped words.
+    EXPECT_NE(hash64(TypeParam{1, 2}), hash64(TypeParam{2, 1}));
+
+    // The words equal to the secrets of the default seed zero the product of the first pair.
+    // The other word of the pair must still affect the hash.
+    const auto s = internal::hash_secrets[1];
+    const auto t = std::rotl(s, 32) ^ internal::hash_secrets[2];
+    std::unordered_set<uint64_t> first_secret;
+    std::unordered_set<uint64_t> second_secret;
+    for (uint64_t w = 0; w < 64; ++w)
+    {
+        first_secret.insert(std::hash<TypeParam>{}(TypeParam{s, w}));
+        second_secret.insert(std::hash<TypeParam>{}(TypeParam{w, t}));
+    }
+    EXPECT_EQ(first_secret.size(), 64);
+    EXPECT_EQ(second_secret.size(), 64);
+
+    std::unordered_set<TypeParam> set(values.begin(), values.end());
+    test::lcg<TypeParam> rng{test::get_seed()};
+    for (int i = 0; i < 100; ++i)
+        set.insert(rng() | 3);
+    EXPECT_EQ(set.size(), values.size() + 100);
+    for (const auto& x : values)
+        EXPECT_TRUE(set.contains(x));
+    EXPECT_FALSE(set.contains(3));
+}
+
+static_assert(sqr(uint256{3}) == 9);
+static_assert(sqr_full(~uint256{0}) == umul(~uint256{0}, ~uint256{0}));
+
+TYPED_TEST(uint_test, sqr)
+{
+    test::lcg<TypeParam> rng{test::get_seed()};
+
+    std::vector<TypeParam> inputs{0, 1, 2, 0xffffffffffffffff, ~TypeParam{0}, ~TypeParam{0} >> 1,
+        TypeParam{1} << (TypeParam::num_bits - 1), TypeParam{1} << (TypeParam::num_bits / 2)};
+    for (int i = 0; i < 100; ++i)
+        inputs.emplace_back(rng());
+
+    for (const auto& x : inputs)
+    {
+        EXPECT_EQ(sqr_full(x), umul(x, x));
+        EXPECT_EQ(sqr(x), x * x);
+    }
+}
+
+static_assert(~uint1024{0} * ~uint1024{0} == 1);
+static_assert(
+    umul(~uint1024{0}, ~uint1024{0}) == internal::umul_portable(~uint1024{0}, ~uint1024{0}));
+
+template <typename T>
+class uint_wide_test : public testing::Test
+{
+};
+using wide_types =
+    testing::Types<uint1024, uint2048, uint4096, intx::uint<8192>, intx::uint<16384>>;
+TYPED_TEST_SUITE(uint_wide_test, wide_types, type_to_name);
+
+TYPED_TEST(uint_wide_test, mul)
+{
+    // The lcg leaves the high words of the widest types zero, so generate all the words directly.
+    std::mt19937_64 gen{test::get_seed()};
+    const auto rng = [&gen] {
+        TypeParam x;
+        std::ranges::generate(as_words(x), std::ref(gen));
+        return x;
+    };
+
+    constexpr auto half = TypeParam::num_bits / 2;
+    const auto ones = ~TypeParam{0};
+    std::vector<TypeParam> inputs{0, 1, ones, ones >> half, ones << half, ones >> 1,
+        TypeParam{1} << (TypeParam::num_bits - 1), (ones >> half) + (TypeParam{1} << half)};
+    for (int i = 0; i < 10; ++i)
+        inputs.emplace_back(rng());
+
+    for (const auto& x : inputs)
+    {
+        for (const auto& y : inputs)
+        {
+            EXPECT_EQ(umul(x, y), internal::umul_portable(x, y));
+            EXPECT_EQ(x * y, internal::mul_portable(x, y));
+        }
+    }
+}
@@ -0,0 +1,252 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+template <unsigned N>
+intx::uint<N> mulmod_ref(
+    const intx::uint<N>& x, const intx::uint<N>& y, const intx::uint<N>& mod) noexcept
+{
+    return udivrem(umul(x, y), mod).rem;
+}
+
+template <unsigned N>
+intx::uint<N> powmod_ref(
+    intx::uint<N> base, intx::uint<N> exp, const intx::uint<N>& mod) noexcept
+{
+    auto result = intx::uint<N>{1} % mod;
+    base %= mod;
+    for (; exp != 0; exp >>= 1)
+    {
+        if ((exp & 1) != 0)
+            result = mulmod_ref(result, base, mod);
+        base = mulmod_ref(base, base, mod);
+    }
+    return result;
+}
+
+/// Returns a set of interesting odd moduli for the given type.
+template <typename T>
+std::vector<T> odd_moduli()
+{
+    constexpr auto num_bits = T::num_bits;
+    std::vector<T> moduli{
+        1,
+        3,
+        0xffffffff00000001,
+        (T{1} << 64) | 1,
+        (T{1} << (num_bits - 1)) + 1,
+        ~T{0},
+        ~T{0} - 2,
+    };
+
+    test::lcg<T> rng{test::get_seed()};
+    for (int i = 0; i < 8; ++i)
+        moduli.emplace_back(rng() | 1);
+    for (int i = 0; i < 4; ++i)
+        moduli.emplace_back((rng() >> (i * 40 + 1)) | 1);
+    return moduli;
+}
+}  // namespace
+
+static_assert(montgomery<256>{3}.from_mont(montgomery<256>{3}.to_mont(5)) == 2);
+static_assert(montgomery<256>{0xffffffff00000001}.modulus() == 0xffffffff00000001);
+
+TYPED_TEST(uint_test, montgomery)
+{
+    test::lcg<TypeParam> rng{test::get_seed()};
+
+    for (const auto& m : odd_moduli<TypeParam>())
+    {
+        const montgomery<TypeParam::num_bits> mont{m};
+
+        for (int i = 0; i < 32; ++i)
+        {
+            const auto x = rng() % m;
+            const auto y = rng() % m;
+            const auto xm = mont.to_mont(x);
+            const auto ym = mont.to_mont(y);
+            EXPECT_LT(xm, m);
+            EXPECT_EQ(mont.from_mont(xm), x);
+
+            EXPECT_EQ(mont.from_mont(mont.mul(xm, ym)), mulmod_ref(x, y, m));
+            EXPECT_EQ(mont.from_mont(mont.sqr(xm)), mulmod_ref(x, x, m));
+
+            const auto s = mont.add(xm, ym);
+            EXPECT_LT(s, m);
+            EXPECT_EQ(
+                mont.from_mont(s), udivrem(intx::uint<TypeParam::num_bits + 64>{x} + y, m).rem);
+
+            const auto d = mont.sub(xm, ym);
+            EXPECT_LT(d, m);
+            EXPECT_EQ(mont.add(d, ym), xm);
+        }
+
+        // Conversion of unreduced values.
+        const auto big = ~TypeParam{0};
+        EXPECT_EQ(mont.from_mont(mont.to_mont(big)), big % m);
+    }
+}
+
+TEST(montgomery, extremes)
+{
+    const auto m = ~uint256{0};
+    const montgomery<256> mont{m};
+    const auto max = m - 1;
+    const auto a = mont.to_mont(max);
+    EXPECT_EQ(mont.from_mont(mont.mul(a, a)), 1);
+    EXPECT_EQ(mont.from_mont(mont.add(a, a)), m - 2);
+    EXPECT_EQ(mont.from_mont(mont.sub(mont.to_mont(0), a)), 1);
+
+    const auto secp256k1_p =
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    const montgomery<256> mp{secp256k1_p};
+    const auto x = 0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798_u256;
+    const auto y = 0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8_u256;
+    EXPECT_EQ(mp.from_mont(mp.mul(mp.to_mont(x), mp.to_mont(y))), mulmod(x, y, secp256k1_p));
+    EXPECT_EQ(mp.from_mont(mp.sqr(mp.to_mont(x))), sqrmod(x, secp256k1_p));
+    EXPECT_EQ(sqrmod(x, secp256k1_p), mulmod(x, x, secp256k1_p));
+}
+
+TYPED_TEST(uint_test, barrett)
+{
+    using WideT = intx::uint<2 * TypeParam::num_bits>;
+    test::lcg<TypeParam> rng{test::get_seed()};
+    test::lcg<WideT> wide_rng{test::get_seed()};
+
+    auto moduli = odd_moduli<TypeParam>();
+    for (size_t i = 0, n = moduli.size(); i < n; ++i)
+    {
+        if (moduli[i] > 1)
+            moduli.emplace_back(moduli[i] - 1);
+    }
+    moduli.emplace_back(2);
+    moduli.emplace_back(TypeParam{1} << (TypeParam::num_bits - 1));
+    moduli.emplace_back(TypeParam{1} << 64);
+
+    for (const auto& m : moduli)
+    {
+        const barrett<TypeParam::num_bits> b{m};
+        EXPECT_EQ(b.modulus(), m);
+
+        for (int i = 0; i < 32; ++i)
+        {
+            const auto x = rng();
+            const auto y = rng();
+            EXPECT_EQ(mulmod(x, y, b), mulmod_ref(x, y, m));
+            EXPECT_EQ(sqrmod(x, b), mulmod_ref(x, x, m));
+
+            const auto w = wide_rng();
+            EXPECT_EQ(b.reduce(w), udivrem(w, m).rem);
+        }
+
+        EXPECT_EQ(b.reduce(~WideT{0}), udivrem(~WideT{0}, m).rem);
+        EXPECT_EQ(b.reduce(WideT{m}), 0);
+        EXPECT_EQ(b.reduce(WideT{m - 1}), m - 1);
+    }
+}
+
+TEST(barrett, constexpr)
+{
+    static_assert(mulmod(0x4028c97ce32bf74a3a3137956b07a5a699ca8422bdf672f547_u256,
+                      0x8c9f09b6227ba6542a97343c679e1d11d8bfa29228c18615c2_u256,
+                      barrett<256>{0xf0f9d0006f7b450e8f73f621a6ca3b56_u128}) ==
+                  0xca283039a2ad0dbd3d60fbadb29e9c7a_u128);
+    static_assert(barrett<128>{10}.reduce(12345_u256) == 5);
+}
+
+TYPED_TEST(uint_test, powmod)
+{
+    test::lcg<TypeParam> rng{test::get_seed()};
+
+    auto moduli = odd_moduli<TypeParam>();
+    moduli.emplace_back(2);
+    moduli.emplace_back(TypeParam{1} << (TypeParam::num_bits - 1));
+    moduli.emplace_back(~TypeParam{0} - 1);
+    moduli.emplace_back(rng() & ~TypeParam{1});
+
+    std::vector<TypeParam> exponents{0, 1, 2, 3, 0x80, 0xffffffffffffffff, ~TypeParam{0}};
+    for (unsigned bits : {9u, 30u, 100u, 250u, 700u})
+    {
+        if (bits < TypeParam::num_bits)
+            exponents.emplace_back(rng() >> (TypeParam::num_bits - bits));
+    }
+
+    for (const auto& m : moduli)
+    {
+        for (const auto& e : exponents)
+        {
+            const auto x = rng();
+            EXPECT_EQ(powmod(x, e, m), powmod_ref(x, e, m));
+        }
+        EXPECT_EQ(powmod(TypeParam{0}, TypeParam{0}, m), TypeParam{1} % m);
+        EXPECT_EQ(powmod(m, TypeParam{5}, m), 0);
+    }
+}
+
+TEST(powmod, fermat)
+{
+    static_assert(powmod(3_u256, 5_u256, 7_u256) == 5);
+    static_assert(powmod(3_u256, 5_u256, 8_u256) == 3);
+
+    const auto secp256k1_p =
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    const auto x = 0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798_u256;
+    EXPECT_EQ(powmod(x, secp256k1_p - 1, secp256k1_p), 1);
+    const auto inv = powmod(x, secp256k1_p - 2, secp256k1_p);
+    EXPECT_EQ(mulmod(x, inv, secp256k1_p), 1);
+}
+
+TYPED_TEST(uint_test, fixed_base_powmod)
+{
+    test::lcg<TypeParam> rng{test::get_seed()};
+
+    auto moduli = odd_moduli<TypeParam>();
+    moduli.emplace_back(2);
+    moduli.emplace_back(~TypeParam{0} - 1);
+    moduli.emplace_back(rng() & ~TypeParam{1});
+
+    for (const auto& m : moduli)
+    {
+        const auto base = rng();
+        const fixed_base_powmod<TypeParam::num_bits> p{base, m};
+        const fixed_base_powmod<TypeParam::num_bits, 1, 1> p11{base, m};
+        const fixed_base_powmod<TypeParam::num_bits, 3, 4> p34{base, m};
+        const fixed_base_powmod<TypeParam::num_bits, 4, 3> p43{base, m, 100};
+        EXPECT_EQ(p.modulus(), m);
+
+        for (const auto& e : {TypeParam{0}, TypeParam{1}, TypeParam{2}, TypeParam{0xff},
+                 TypeParam{0xffffffffffffffff}, ~TypeParam{0}, rng(), rng() >> 1})
+        {
+            const auto expected = powmod(base, e, m);
+            EXPECT_EQ(p.pow(e), expected);
+            EXPECT_EQ(p11.pow(e), expected);
+            EXPECT_EQ(p34.pow(e), expected);
+            if (bit_width(e) <= 100)
+            {
+                EXPECT_EQ(p43.pow(e), expected);
+            }
+        }
+        const auto e = rng() >> (TypeParam::num_bits - 100);
+        EXPECT_EQ(p43.pow(e), powmod_ref(base, e, m));
+    }
+}
+
+TEST(fixed_base_powmod, secp256k1)
+{
+    static_assert(fixed_base_powmod<256>{3, 7}.pow(5) == 5);
+    static_assert(fixed_base_powmod<256, 2, 2>{3, 8, 3}.pow(5) == 3);
+
+    const auto secp256k1_p =
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    const auto x = 0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798_u256;
+    const fixed_base_powmod<256, 6, 4> p{x, secp256k1_p};
+    EXPECT_EQ(p.pow(secp256k1_p - 1), 1);
+    EXPECT_EQ(mulmod(x, p.pow(secp256k1_p - 2), secp256k1_p), 1);
+}
@@ -0,0 +1,98 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/sort.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+/// Returns the inputs of different distributions: random, with the zero high words,
+/// with many duplicates, equal, sorted and reverse sorted.
+template <typename T>
+std::vector<std::vector<T>> inputs(size_t n)
+{
+    test::lcg<T> rng{test::get_seed()};
+    std::vector<std::vector<T>> v(6, std::vector<T>(n));
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto x = rng();
+        v[0][i] = x;
+        v[1][i] = x >> (T::num_bits - 80);
+        v[2][i] = (x >> (T::num_bits - 4)) << 70;
+        v[3][i] = T{1} << 65;
+        v[4][i] = T{i} << (T::num_bits / 2);
+        v[5][i] = ~T{i};
+    }
+    return v;
+}
+}  // namespace
+
+TYPED_TEST(uint_test, radix_sort)
+{
+    for (const size_t n : {0u, 1u, 2u, 63u, 64u, 65u, 300u, 5000u})
+    {
+        for (auto keys : inputs<TypeParam>(n))
+        {
+            auto expected = keys;
+            std::sort(expected.begin(), expected.end());
+            radix_sort(std::span{keys});
+            EXPECT_EQ(keys, expected) << n;
+        }
+    }
+}
+
+TYPED_TEST(uint_test, radix_sort_key_value)
+{
+    for (const size_t n : {0u, 1u, 2u, 63u, 64u, 65u, 300u, 5000u})
+    {
+        for (auto keys : inputs<TypeParam>(n))
+        {
+            const auto original = keys;
+            std::vector<std::string> values(n);
+            for (size_t i = 0; i < n; ++i)
+                values[i] = std::to_string(i);
+
+            radix_sort(std::span{keys}, std::span{values});
+            EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end())) << n;
+            for (size_t i = 0; i < n; ++i)
+            {
+                const auto index = std::stoul(values[i]);
+                ASSERT_EQ(keys[i], original[index]) << n;
+                if (i != 0 && keys[i] == keys[i - 1])  // Stable.
+                {
+                    EXPECT_LT(std::stoul(values[i - 1]), index) << n;
+                }
+            }
+        }
+    }
+}
+
+TEST(radix_sort, parallel)
+{
+    constexpr auto n = 3 * internal::radix_sort_min_chunk + 7;
+    for (const unsigned num_threads : {0u, 1u, 2u, 4u, 100u})
+    {
+        for (auto keys : inputs<uint256>(n))
+        {
+            auto expected = keys;
+            std::sort(expected.begin(), expected.end());
+            std::vector<uint32_t> values(n);
+            for (size_t i = 0; i < n; ++i)
+                values[i] = static_cast<uint32_t>(i);
+            auto keys2 = keys;
+
+            radix_sort(std::span{keys}, num_threads);
+            EXPECT_EQ(keys, expected) << num_threads;
+
+            const auto original = keys2;
+            radix_sort(std::span{keys2}, std::span{values}, num_threads);
+            EXPECT_EQ(keys2, expected) << num_threads;
+            for (size_t i = 0; i < n; ++i)
+                ASSERT_EQ(keys2[i], original[values[i]]) << num_threads;
+        }
+    }
+}
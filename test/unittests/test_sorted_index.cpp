@@ -0,0 +1,92 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/sorted_index.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+/// Checks all the lookups of the index against std::lower_bound() for the keys,
+/// their neighbours and the given extra queries.
+template <typename T>
+void check_index(std::vector<T> keys, std::vector<T> queries)
+{
+    const sorted_index<T::num_bits> index{keys};
+    std::sort(keys.begin(), keys.end());
+    ASSERT_EQ(index.size(), keys.size());
+    ASSERT_TRUE(std::ranges::equal(index.keys(), keys));
+
+    for (const auto& k : keys)
+    {
+        queries.push_back(k);
+        queries.push_back(k + 1);
+        queries.push_back(k - 1);
+    }
+    queries.push_back(0);
+    queries.push_back(~T{0});
+
+    std::vector<size_t> batch(queries.size());
+    index.lower_bound(queries, batch);
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        const auto& x = queries[i];
+        const auto expected =
+            static_cast<size_t>(std::lower_bound(keys.begin(), keys.end(), x) - keys.begin());
+        ASSERT_EQ(index.lower_bound(x), expected) << hex(x);
+        ASSERT_EQ(batch[i], expected) << hex(x);
+        ASSERT_EQ(index.contains(x), std::binary_search(keys.begin(), keys.end(), x)) << hex(x);
+    }
+}
+}  // namespace
+
+TYPED_TEST(uint_test, sorted_index)
+{
+    test::lcg<TypeParam> rng{test::get_seed()};
+    for (const size_t n : {0u, 1u, 7u, 8u, 9u, 80u, 81u, 1000u})
+    {
+        std::vector<TypeParam> keys(n);
+        std::vector<TypeParam> queries(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            keys[i] = rng();
+            queries[i] = rng();
+        }
+        if (n > 2)
+            keys[n - 1] = keys[n - 2] = keys[0];  // Duplicates.
+        check_index(keys, queries);
+
+        // The search word lower than the top one.
+        for (auto& k : keys)
+            k >>= TypeParam::num_bits - 70;
+        for (auto& q : queries)
+            q >>= TypeParam::num_bits - 72;
+        check_index(keys, queries);
+
+        // The constant high words, different than the ones of some queries.
+        for (auto& k : keys)
+            k |= TypeParam{0xabc} << (TypeParam::num_bits - 64);
+        for (size_t i = 0; i < n; ++i)
+            queries[i] |= TypeParam{0xabb + i % 3} << (TypeParam::num_bits - 64);
+        check_index(keys, queries);
+    }
+}
+
+TEST(sorted_index, equal_search_words)
+{
+    // The long runs of the keys with equal search words.
+    test::lcg<uint256> rng{test::get_seed()};
+    std::vector<uint256> keys(3000);
+    std::vector<uint256> queries(3000);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = (rng() >> 64) | uint256{i % 5} << 192;
+        queries[i] = (rng() >> 64) | uint256{i % 7} << 192;
+    }
+    check_index(keys, queries);
+
+    check_index(std::vector<uint256>(100, 5), {4, 5, 6});
+}
@@ -227,6 +227,16 @@ TEST(uint256, mulmod)
     EXPECT_EQ(mulmod(a, b, mod), 0xca283039a2ad0dbd3d60fbadb29e9c7a_u128);
 }
 
+TEST(uint256, sqrmod)
+{
+    static_assert(sqrmod(3_u256, 7_u256) == 2);
+
+    const auto x = 0x4028c97ce32bf74a3a3137956b07a5a699ca8422bdf672f547_u256;
+    const auto mod = 0xf0f9d0006f7b450e8f73f621a6ca3b56_u128;
+    EXPECT_EQ(sqrmod(x, mod), mulmod(x, x, mod));
+    EXPECT_EQ(sqrmod(~uint256{0}, mod), mulmod(~uint256{0}, ~uint256{0}, mod));
+}
+
 #if INTX_HAS_BUILTIN_INT128
 TEST(uint256, conversion_from_builtin_uint128)
 {
@@ -0,0 +1,113 @@
+// intx: extended precision integer library.
+// Copyright 2026 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+#if INTX_HAS_X86_64_ASM
+
+namespace
+{
+bool has_mulx_adx() noexcept
+{
+    return __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+}
+
+template <typename T>
+std::vector<T> mul_inputs()
+{
+    std::vector<T> inputs{0, 1, 2, 0xffffffffffffffff, ~T{0}, ~T{0} - 1, ~T{0} >> 1,
+        T{1} << (T::num_bits - 1), (T{1} << 64) - 1};
+    test::lcg<T> rng{test::get_seed()};
+    for (int i = 0; i < 200; ++i)
+        inputs.emplace_back(rng());
+    for (int i = 0; i < 20; ++i)
+        inputs.emplace_back(rng() >> (i * 17));
+    return inputs;
+}
+}  // namespace
+
+TEST(x86_64, umul_256)
+{
+    if (!has_mulx_adx())
+        GTEST_SKIP() << "BMI2 and ADX not supported";
+
+    const auto inputs = mul_inputs<uint256>();
+    for (const auto& x : inputs)
+    {
+        for (const auto& y : inputs)
+        {
+            uint512 p;
+            internal::x86_64::umul_256(&p[0], &x[0], &y[0]);
+            ASSERT_EQ(p, internal::umul_portable(x, y));
+        }
+    }
+}
+
+TEST(x86_64, mul_256)
+{
+    if (!has_mulx_adx())
+        GTEST_SKIP() << "BMI2 and ADX not supported";
+
+    const auto inputs = mul_inputs<uint256>();
+    for (const auto& x : inputs)
+    {
+        for (const auto& y : inputs)
+        {
+            uint256 p;
+            internal::x86_64::mul_256(&p[0], &x[0], &y[0]);
+            ASSERT_EQ(p, internal::mul_portable(x, y));
+        }
+    }
+}
+
+TEST(x86_64, mul_512)
+{
+    if (!has_mulx_adx())
+        GTEST_SKIP() << "BMI2 and ADX not supported";
+
+    const auto inputs = mul_inputs<uint512>();
+    for (const auto& x : inputs)
+    {
+        for (const auto& y : inputs)
+        {
+            uint512 p;
+            internal::x86_64::mul_512(&p[0], &x[0], &y[0]);
+            ASSERT_EQ(p, internal::mul_portable(x, y));
+        }
+    }
+}
+
+TEST(x86_64, submul)
+{
+    if (!has_mulx_adx())
+        GTEST_SKIP() << "BMI2 and ADX not supported";
+
+    const auto inputs = mul_inputs<intx::uint<640>>();
+    test::lcg<uint64_t> rng{test::get_seed()};
+    std::vector<uint64_t> multipliers{0, 1, 2, 0xffffffffffffffff, 0x8000000000000000};
+    for (int i = 0; i < 20; ++i)
+        multipliers.emplace_back(rng());
+
+    for (size_t n = 1; n <= intx::uint<640>::num_words; ++n)
+    {
+        for (size_t i = 0; i + 1 < inputs.size(); ++i)
+        {
+            for (const auto m : multipliers)
+            {
+                auto a = inputs[i];
+                auto b = inputs[i];
+                const auto y = as_words(inputs[i + 1]).subspan(0, n);
+                const auto borrow_a = internal::x86_64::submul(&a[0], y.data(), n, m);
+                const auto borrow_b = internal::submul_portable(&b[0], y, m);
+                ASSERT_EQ(a, b);
+                ASSERT_EQ(borrow_a, borrow_b);
+            }
+        }
+    }
+}
+
+#endif
@@ -26,25 +26,27 @@ inline Int mul(const Int& x, const Int& y) noexcept
     return p[0];
 }
 
-inline uint512 mul_full(const uint256& x, const uint256& y) noexcept
+template <unsigned N>
+inline uint<2 * N> mul_full(const uint<N>& x, const uint<N>& y) noexcept
 {
-    uint512 p;
+    constexpr size_t num_limbs = sizeof(x) / sizeof(mp_limb_t);
+    uint<2 * N> p;
     auto p_p = reinterpret_cast<mp_ptr>(&p);
     auto p_x = reinterpret_cast<mp_srcptr>(&x);
     auto p_y = reinterpret_cast<mp_srcptr>(&y);
-    mpn_mul_n(p_p, p_x, p_y, uint256_limbs);
+    mpn_mul_n(p_p, p_x, p_y, num_limbs);
     return p;
 }
 
-template <typename Int>
-inline div_result<Int> udivrem(const Int& x, const Int& y) noexcept
+template <typename Int, typename Den = Int>
+inline div_result<Int, Den> udivrem(const Int& x, const Den& y) noexcept
 {
     // Skip dividend's leading zero limbs.
     constexpr auto x_limbs = sizeof(Int) / sizeof(mp_limb_t);
     const auto y_limbs = static_cast<mp_size_t>(count_significant_words(y));
 
     Int q;
-    Int r;
+    Den r;
     auto p_q = (mp_ptr)&q;
     auto p_r = (mp_ptr)&r;
     auto p_x = (mp_srcptr)&x;
@@ -80,7 +82,7 @@ inline div_result<Int> sdivrem(const Int& x, const Int& y) noexcept
 
     mpz_tdiv_qr(q_gmp, r_gmp, x_gmp, y_gmp);
 
-    char buf[2000];
+    char buf[sizeof(Int) * 3 + 2];
 
     mpz_get_str(buf, 10, q_gmp);
     auto q_is_neg = buf[0] == '-';
@@ -143,4 +145,40 @@ inline Int addmod(const Int& x, const Int& y, const Int& mod) noexcept
     return rem;
 }
 
+template <typename Int>
+inline Int mulmod(const Int& x, const Int& y, const Int& mod) noexcept
+{
+    constexpr size_t gmp_limbs = sizeof(Int) / sizeof(mp_limb_t);
+    const auto mod_limbs = static_cast<mp_size_t>(count_significant_words(mod));
+
+    mp_limb_t prod[2 * gmp_limbs];
+    mpn_mul_n(prod, (mp_srcptr)&x, (mp_srcptr)&y, gmp_limbs);
+
+    mp_limb_t quot[2 * gmp_limbs];
+    Int rem;
+    mpn_tdiv_qr(quot, (mp_ptr)&rem, 0, prod, 2 * gmp_limbs, (mp_srcptr)&mod, mod_limbs);
+    return rem;
+}
+
+template <typename Int>
+inline Int powmod(const Int& base, const Int& exp, const Int& mod) noexcept
+{
+    constexpr auto gmp_limbs = static_cast<mp_size_t>(sizeof(Int) / sizeof(mp_limb_t));
+
+    mpz_t b;
+    mpz_t e;
+    mpz_t m;
+    mpz_t r;
+    mpz_roinit_n(b, (mp_srcptr)&base, gmp_limbs);
+    mpz_roinit_n(e, (mp_srcptr)&exp, gmp_limbs);
+    mpz_roinit_n(m, (mp_srcptr)&mod, gmp_limbs);
+    mpz_init(r);
+    mpz_powm(r, b, e, m);
+
+    Int result;
+    mpz_export(&result, nullptr, -1, sizeof(mp_limb_t), 0, 0, r);
+    mpz_clear(r);
+    return result;
+}
+
 }  // namespace intx::gmp